@@ -0,0 +1,539 @@
+// bench/bench.cpp
+// Benchmark harness for the task libraries. For every task, generator and
+// size it builds the driver input in memory, times run_task on it (parse,
+// solve and formatting, output into a string) and, while n is small enough,
+// checks the output against the naive reference. Some tasks also probe the
+// library parts that run_task does not reach (dynamic structures, point
+// location) on the same input.
+//
+//   bench [--tasks KIDFGH] [--sizes n1,n2,...] [--reps R] [--seed S]
+//         [--threads T] [--format json|csv] [--no-check]
+//   bench --emit TASK GENERATOR N [--seed S]   print one input to stdout
+//
+// Results go to stdout as JSON (default) or CSV, one record per case with
+// min and median wall time over the repetitions; the exit code is 1 if any
+// check failed.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "bench/generators.h"
+#include "bench/reference.h"
+#include "convex_layers.h"
+#include "fast_io.h"
+#include "hull3d.h"
+#include "minkowski.h"
+#include "pattern_matching.h"
+#include "polynomial_inverse.h"
+#include "voronoi.h"
+
+namespace {
+
+using bench::Rng;
+
+// Compares the task output with the reference for the same input text.
+using Checker = std::function<bool(std::string_view input, std::string_view output)>;
+// Further checks driven by the input alone; rng picks the random operations.
+using Probe = std::function<bool(std::string_view input, Rng& rng)>;
+
+struct Task {
+    char id;
+    std::vector<std::string> generators;
+    std::vector<int> sizes;  // default sweep
+    int check_limit;         // largest n the naive reference is run on
+    std::function<void(const std::string&, int, Rng&, fastio::Writer&)> generate;
+    std::function<void(fastio::Reader&, fastio::Writer&, int threads)> run;
+    Checker check;
+    Probe probe;  // optional
+};
+
+template <class T>
+std::vector<T> read_all(fastio::Reader& in) {
+    std::vector<T> v;
+    for (T x; in.read(x);) v.push_back(x);
+    return v;
+}
+
+bool close(double a, double b, double tol) {
+    return std::fabs(a - b) <= tol * std::max(1.0, std::fabs(b));
+}
+
+bool check_wildcard(std::string_view input, std::string_view output) {
+    fastio::Reader in(input), res(output);
+    std::string pattern, text;
+    in.line(pattern);
+    in.line(text);
+    return read_all<int>(res) == bench::naive::wildcard_matches(pattern, text);
+}
+
+bool check_polynomial(std::string_view input, std::string_view output) {
+    fastio::Reader in(input), res(output);
+    int q = in.next<int>(), p = in.next<int>();
+    std::vector<int> coeffs(p + 1);
+    for (auto& c : coeffs) in.read(c);
+    return read_all<int>(res) == bench::naive::series_inverse(q, coeffs);
+}
+
+bool check_minkowski(std::string_view input, std::string_view output) {
+    fastio::Reader in(input), res(output);
+    int n = in.next<int>(), m = in.next<int>();
+    std::vector<bench::naive::Point2> A(n), B(m);
+    for (auto& p : A) { in.read(p.x); in.read(p.y); }
+    for (auto& p : B) { in.read(p.x); in.read(p.y); }
+    double expect = static_cast<double>(bench::naive::minkowski_answer(A, B));
+    return close(res.next<double>(), expect, 1e-6);
+}
+
+bool check_hull3d(std::string_view input, std::string_view output) {
+    fastio::Reader in(input), res(output);
+    auto read3 = [&in](std::size_t k) {
+        std::vector<bench::naive::Vec3> v(k);
+        for (auto& p : v)
+            for (auto& c : p) in.read(c);
+        return v;
+    };
+    auto pts = read3(in.next<std::size_t>());
+    auto queries = read3(in.next<std::size_t>());
+    auto expect = bench::naive::hull_distances(pts, queries);
+    auto got = read_all<double>(res);
+    if (got.size() != expect.size()) return false;
+    for (std::size_t i = 0; i < got.size(); ++i)
+        if (!close(got[i], expect[i], 1e-6)) return false;
+    return true;
+}
+
+bool check_voronoi(std::string_view input, std::string_view output) {
+    fastio::Reader in(input), res(output);
+    double X = in.next<int>(), Y = in.next<int>();
+    std::vector<std::array<double, 2>> sites(in.next<int>());
+    for (auto& s : sites) { in.read(s[0]); in.read(s[1]); }
+    auto expect = bench::naive::voronoi_areas(X, Y, sites);
+    for (double want : expect) {
+        int k = 0;
+        if (!res.read(k)) return false;
+        std::vector<std::array<double, 2>> poly(k);
+        for (auto& v : poly) { res.read(v[0]); res.read(v[1]); }
+        double area = 0;
+        for (int i = 0; i < k; ++i)
+            area += poly[i][0] * poly[(i + 1) % k][1] - poly[i][1] * poly[(i + 1) % k][0];
+        if (!close(std::fabs(area) / 2, want, 1e-6)) return false;
+    }
+    int extra = 0;
+    return !res.read(extra);
+}
+
+double area(const std::vector<voronoi::Point>& poly) {
+    double a = 0;
+    for (std::size_t i = 0; i < poly.size(); ++i) {
+        const auto& u = poly[i];
+        const auto& v = poly[(i + 1) % poly.size()];
+        a += u.x * v.y - u.y * v.x;
+    }
+    return std::fabs(a) / 2;
+}
+
+// Replays the sites through DynamicVoronoi: insert all, erase random ones
+// down to an eighth (the grid shrinks), insert them back (erased ids are
+// reused). Every few operations each live cell's area is compared with
+// solve on the live set.
+bool probe_dynamic_voronoi(std::string_view input, Rng& rng) {
+    fastio::Reader in(input);
+    int X = in.next<int>(), Y = in.next<int>();
+    std::vector<voronoi::Point> sites(in.next<int>());
+    for (auto& s : sites) { in.read(s.x); in.read(s.y); }
+    int n = static_cast<int>(sites.size());
+    voronoi::DynamicVoronoi dyn(X, Y);
+    std::vector<int> id(n);  // id of site k in dyn, -1 while erased
+    for (int k = 0; k < n; ++k) id[k] = dyn.insert(sites[k]);
+
+    auto matches = [&]() {
+        std::vector<voronoi::Point> live;
+        std::vector<int> ids;
+        for (int k = 0; k < n; ++k)
+            if (id[k] >= 0) {
+                live.push_back(sites[k]);
+                ids.push_back(id[k]);
+            }
+        if (dyn.size() != static_cast<int>(live.size())) return false;
+        auto cells = voronoi::solve(X, Y, live);
+        for (std::size_t i = 0; i < live.size(); ++i)
+            if (ids[i] >= n || !close(area(dyn.cell(ids[i])), area(cells[i]), 1e-6))
+                return false;
+        return true;
+    };
+    if (!matches()) return false;
+
+    std::vector<int> order(n);
+    for (int k = 0; k < n; ++k) order[k] = k;
+    std::shuffle(order.begin(), order.end(), rng);
+    int keep = n / 8, every = std::max(1, n / 16);
+    for (int step = 0; step < n - keep; ++step) {
+        int k = order[step];
+        dyn.erase(id[k]);
+        id[k] = -1;
+        if (step % every == 0 && !matches()) return false;
+    }
+    if (!matches()) return false;
+    std::shuffle(order.begin(), order.begin() + (n - keep), rng);
+    for (int step = 0; step < n - keep; ++step) {
+        int k = order[step];
+        id[k] = dyn.insert(sites[k]);
+        if (id[k] >= n) return false;
+        if (step % every == 0 && !matches()) return false;
+    }
+    return matches();
+}
+
+// SiteLocator against a linear scan: random points around the rectangle
+// (outside ones must give -1), the sites themselves and midpoints of random
+// site pairs, where the lower index must win the tie. Both the single and
+// the batched (threaded) locate are checked.
+bool probe_site_locator(std::string_view input, Rng& rng) {
+    fastio::Reader in(input);
+    int X = in.next<int>(), Y = in.next<int>();
+    std::vector<voronoi::Point> sites(in.next<int>());
+    for (auto& s : sites) { in.read(s.x); in.read(s.y); }
+    int n = static_cast<int>(sites.size());
+    std::vector<voronoi::Point> qs = {{0, 0}, {static_cast<double>(X), static_cast<double>(Y)}};
+    for (int i = 0; i < 2 * n; ++i)
+        qs.push_back({bench::uniform_real(rng, -0.1 * X, 1.1 * X),
+                      bench::uniform_real(rng, -0.1 * Y, 1.1 * Y)});
+    for (int i = 0; i < n; ++i) {
+        const auto& a = sites[i];
+        const auto& b = sites[bench::uniform(rng, 0, n - 1)];
+        qs.push_back(a);
+        qs.push_back({(a.x + b.x) / 2, (a.y + b.y) / 2});
+    }
+    auto brute = [&](const voronoi::Point& q) {
+        if (q.x < 0 || q.y < 0 || q.x > X || q.y > Y) return -1;
+        int best = -1;
+        double best_d2 = 0;
+        for (int i = 0; i < n; ++i) {
+            double dx = sites[i].x - q.x, dy = sites[i].y - q.y;
+            double d2 = dx * dx + dy * dy;
+            if (best < 0 || d2 < best_d2) best = i, best_d2 = d2;
+        }
+        return best;
+    };
+    voronoi::SiteLocator locator(X, Y, sites);
+    auto batch = locator.locate(qs, 4);
+    for (std::size_t i = 0; i < qs.size(); ++i) {
+        int want = brute(qs[i]);
+        if (locator.locate(qs[i]) != want || batch[i] != want) return false;
+    }
+    return true;
+}
+
+bool probe_voronoi(std::string_view input, Rng& rng) {
+    return probe_dynamic_voronoi(input, rng) && probe_site_locator(input, rng);
+}
+
+bool check_layers(std::string_view input, std::string_view output) {
+    fastio::Reader in(input), res(output);
+    auto pts = onion::read_points(in);
+    auto queries = onion::read_points(in);
+    return read_all<int>(res) == bench::naive::layer_depths(pts, queries);
+}
+
+// Replays the attractions through DynamicLayers: build from all of them,
+// erase random ones down to half, then insert the query points. Every few
+// operations the layers (as vertex sets) and the depth of every query are
+// compared with the naive peeling of the live points.
+bool probe_dynamic_layers(std::string_view input, Rng& rng) {
+    fastio::Reader in(input);
+    auto pts = onion::read_points(in);
+    auto queries = onion::read_points(in);
+    auto normalized = [](std::vector<onion::Point> v) {
+        std::sort(v.begin(), v.end(), onion::cmp_xy);
+        v.erase(std::unique(v.begin(), v.end(), onion::same), v.end());
+        return v;
+    };
+    std::vector<onion::Point> live = pts;
+    onion::DynamicLayers dyn(pts);
+
+    auto matches = [&]() {
+        auto layers = bench::naive::peel_layers(live);
+        if (dyn.size() != static_cast<int>(layers.size())) return false;
+        for (int k = 0; k < dyn.size(); ++k) {
+            auto a = normalized(dyn.layer(k)), b = normalized(layers[k]);
+            if (!std::equal(a.begin(), a.end(), b.begin(), b.end(), onion::same)) return false;
+        }
+        auto depths = bench::naive::layer_depths(live, queries);
+        for (std::size_t i = 0; i < queries.size(); ++i)
+            if (dyn.depth(queries[i]) != depths[i]) return false;
+        return true;
+    };
+    if (!matches()) return false;
+
+    int every = std::max<std::size_t>(1, pts.size() / 16);
+    std::shuffle(live.begin(), live.end(), rng);
+    for (int step = 0; live.size() > pts.size() / 2; ++step) {
+        onion::Point p = live.back();
+        live.pop_back();
+        bool dup = std::any_of(live.begin(), live.end(),
+                               [&](const onion::Point& q) { return onion::same(p, q); });
+        if (!dyn.erase(p)) return false;
+        if (dup) dyn.insert(p);  // the set keeps one copy of a repeated point
+        if (step % every == 0 && !matches()) return false;
+    }
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        dyn.insert(queries[i]);
+        live.push_back(queries[i]);
+        if (static_cast<int>(i) % every == 0 && !matches()) return false;
+    }
+    return matches();
+}
+
+// fast_hull against the two-chain reference, vertex for vertex: the
+// attractions as given and then moved next to 2^31, collinear sets, points
+// that are all vertices (on a parabola, shuffled, with repeats) and sets
+// whose spread is just under, at and far over the 31-bit limit of the
+// Akl–Toussaint filter.
+bool probe_fast_hull(std::string_view input, Rng& rng) {
+    fastio::Reader in(input);
+    auto pts = onion::read_points(in);
+    auto queries = onion::read_points(in);
+    pts.insert(pts.end(), queries.begin(), queries.end());
+    int n = static_cast<int>(pts.size());
+    auto agrees = [](const std::vector<onion::Point>& v) {
+        std::vector<onion::Point> copy = v;
+        auto want = bench::naive::convex_hull(copy);
+        for (int threads : {1, 4}) {
+            auto got = onion::fast_hull(v, threads);
+            if (!std::equal(got.begin(), got.end(), want.begin(), want.end(), onion::same))
+                return false;
+        }
+        return true;
+    };
+    if (!agrees(pts)) return false;
+
+    const std::int64_t big = std::int64_t{1} << 31;
+    std::vector<onion::Point> shifted = pts;
+    for (auto& p : shifted) p.x += big - 1 - 1000000000, p.y -= big - 1000000000;
+    if (!agrees(shifted)) return false;
+
+    std::vector<onion::Point> line(n);
+    std::int64_t dx = bench::uniform(rng, -5, 5), dy = bench::uniform(rng, 1, 5);
+    for (auto& p : line) {
+        std::int64_t t = bench::uniform(rng, -n, n);
+        p = {big - 1 + t * dx, t * dy - big};
+    }
+    if (!agrees(line)) return false;
+
+    std::vector<onion::Point> parabola;
+    for (int i = 0; i < n; ++i) {
+        std::int64_t t = i - n / 2;
+        parabola.push_back({t, t * t});
+        if (i % 7 == 0) parabola.push_back({t, t * t});
+    }
+    std::shuffle(parabola.begin(), parabola.end(), rng);
+    if (!agrees(parabola)) return false;
+
+    for (std::int64_t span : {big - 1, big, std::int64_t{1} << 40}) {
+        std::vector<onion::Point> wide(n);
+        for (auto& p : wide)
+            p = {bench::uniform(rng, -span / 2, span - span / 2),
+                 bench::uniform(rng, -span / 2, span - span / 2)};
+        wide[0] = {-span / 2, 0};
+        wide[1] = {span - span / 2, 0};
+        if (!agrees(wide)) return false;
+    }
+    return true;
+}
+
+bool probe_layers(std::string_view input, Rng& rng) {
+    return probe_dynamic_layers(input, rng) && probe_fast_hull(input, rng);
+}
+
+std::vector<Task> make_tasks() {
+    return {
+        {'K', {"random", "periodic", "nearmiss"}, {10000, 100000, 1000000}, 20000,
+         bench::gen_wildcard,
+         [](fastio::Reader& in, fastio::Writer& out, int) { wildcard::runTask(in, out); },
+         check_wildcard, {}},
+        {'I', {"pow2", "pow2plus"}, {1024, 16384, 262144}, 4096, bench::gen_polynomial,
+         [](fastio::Reader& in, fastio::Writer& out, int) { poly::RunTask(in, out); },
+         check_polynomial, {}},
+        {'D', {"circle", "ellipse"}, {1000, 10000, 100000, 1000000}, 1000, bench::gen_minkowski,
+         [](fastio::Reader& in, fastio::Writer& out, int) { minkowski::run_task(in, out); },
+         check_minkowski, {}},
+        {'F', {"ball", "sphere", "nearcoplanar"}, {40, 1000, 10000}, 40, bench::gen_hull3d,
+         [](fastio::Reader& in, fastio::Writer& out, int) { hull::RunTask(in, out); },
+         check_hull3d, {}},
+        {'G', {"uniform", "clustered", "lattice"}, {1000, 10000, 100000}, 1500,
+         bench::gen_voronoi,
+         [](fastio::Reader& in, fastio::Writer& out, int t) { voronoi::run_task(in, out, t); },
+         check_voronoi, probe_voronoi},
+        {'H', {"uniform", "rings", "grid"}, {1000, 10000, 100000, 1000000}, 2000,
+         bench::gen_layers,
+         [](fastio::Reader& in, fastio::Writer& out, int t) { onion::run_task(in, out, t); },
+         check_layers, probe_layers},
+    };
+}
+
+struct Result {
+    char task;
+    std::string generator;
+    int n;
+    int reps;
+    double min_s, median_s;
+    const char* check;  // "ok", "fail" or "skipped"
+};
+
+void print_json(fastio::Writer& out, const std::vector<Result>& results) {
+    out.write("{\"results\": [");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out.write(i ? ",\n  " : "\n  ");
+        out.write("{\"task\": \"");
+        out.put(r.task);
+        out.write("\", \"generator\": \"");
+        out.write(r.generator);
+        out.write("\", \"n\": ");
+        out.write(r.n);
+        out.write(", \"reps\": ");
+        out.write(r.reps);
+        out.write(", \"min_s\": ");
+        out.write_fixed(r.min_s, 6);
+        out.write(", \"median_s\": ");
+        out.write_fixed(r.median_s, 6);
+        out.write(", \"check\": \"");
+        out.write(r.check);
+        out.write("\"}");
+    }
+    out.write("\n]}\n");
+}
+
+void print_csv(fastio::Writer& out, const std::vector<Result>& results) {
+    out.write("task,generator,n,reps,min_s,median_s,check\n");
+    for (const Result& r : results) {
+        out.put(r.task);
+        out.put(',');
+        out.write(r.generator);
+        out.put(',');
+        out.write(r.n);
+        out.put(',');
+        out.write(r.reps);
+        out.put(',');
+        out.write_fixed(r.min_s, 6);
+        out.put(',');
+        out.write_fixed(r.median_s, 6);
+        out.put(',');
+        out.write(r.check);
+        out.put('\n');
+    }
+}
+
+std::vector<int> parse_sizes(std::string_view s) {
+    std::vector<int> v;
+    while (!s.empty()) {
+        std::size_t comma = std::min(s.find(','), s.size());
+        fastio::Reader in(s.substr(0, comma));
+        int n = 0;
+        if (in.read(n) && n > 0) v.push_back(n);
+        s.remove_prefix(std::min(comma + 1, s.size()));
+    }
+    return v;
+}
+
+int usage() {
+    std::fputs("usage: bench [--tasks KIDFGH] [--sizes n1,n2,...] [--reps R] [--seed S]\n"
+               "             [--threads T] [--format json|csv] [--no-check]\n"
+               "       bench --emit TASK GENERATOR N [--seed S]\n",
+               stderr);
+    return 2;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string tasks_arg = "KIDFGH", format = "json";
+    std::vector<int> sizes;
+    int reps = 3;
+    unsigned long long seed = 1;
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    bool check = true;
+    std::vector<std::string> emit;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view a = argv[i];
+        auto value = [&]() -> std::string_view { return i + 1 < argc ? argv[++i] : ""; };
+        if (a == "--tasks") tasks_arg = value();
+        else if (a == "--sizes") sizes = parse_sizes(value());
+        else if (a == "--reps") reps = std::max(1, std::atoi(value().data()));
+        else if (a == "--seed") seed = std::strtoull(value().data(), nullptr, 10);
+        else if (a == "--threads") threads = std::max(1, std::atoi(value().data()));
+        else if (a == "--format") format = value();
+        else if (a == "--no-check") check = false;
+        else if (a == "--emit" && i + 3 < argc) emit.assign(argv + i + 1, argv + i + 4), i += 3;
+        else return usage();
+    }
+    if (format != "json" && format != "csv") return usage();
+
+    const std::vector<Task> tasks = make_tasks();
+    fastio::Writer out;
+
+    if (!emit.empty()) {
+        for (const Task& t : tasks) {
+            if (emit[0].size() != 1 || emit[0][0] != t.id) continue;
+            if (std::find(t.generators.begin(), t.generators.end(), emit[1]) == t.generators.end())
+                return usage();
+            Rng rng(seed);
+            t.generate(emit[1], std::atoi(emit[2].c_str()), rng, out);
+            return 0;
+        }
+        return usage();
+    }
+
+    std::vector<Result> results;
+    bool failed = false;
+    for (const Task& t : tasks) {
+        if (tasks_arg.find(t.id) == std::string::npos) continue;
+        for (const std::string& gen : t.generators) {
+            for (int n : sizes.empty() ? t.sizes : sizes) {
+                Rng rng(seed ^ (static_cast<unsigned long long>(n) << 20));
+                std::string input;
+                {
+                    fastio::Writer w(input);
+                    t.generate(gen, n, rng, w);
+                }
+                std::vector<double> times;
+                std::string output;
+                for (int r = 0; r < reps; ++r) {
+                    output.clear();
+                    auto start = std::chrono::steady_clock::now();
+                    {
+                        fastio::Reader in(input);
+                        fastio::Writer w(output);
+                        t.run(in, w, threads);
+                    }
+                    std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+                    times.push_back(took.count());
+                }
+                std::sort(times.begin(), times.end());
+                const char* verdict = "skipped";
+                if (check && n <= t.check_limit) {
+                    Rng probe_rng(seed ^ static_cast<unsigned long long>(n));
+                    bool ok = t.check(input, output) && (!t.probe || t.probe(input, probe_rng));
+                    verdict = ok ? "ok" : "fail";
+                    failed |= !ok;
+                }
+                results.push_back({t.id, gen, n, reps, times.front(), times[times.size() / 2], verdict});
+                std::fprintf(stderr, "%c %-12s n=%-9d %.6fs %s\n", t.id, gen.c_str(), n,
+                             times.front(), verdict);
+            }
+        }
+    }
+
+    if (format == "json") print_json(out, results);
+    else print_csv(out, results);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,226 @@
+// bench/generators.h
+// Scalable input generators for every task. Each generator writes a complete
+// driver input (the same text the Contest* binaries read on stdin), so the
+// output can be fed to the drivers, the server or the benchmark alike.
+// n is the main size knob; the generator name picks the input family.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fast_io.h"
+
+namespace bench {
+
+using Rng = std::mt19937_64;
+
+inline std::int64_t uniform(Rng& rng, std::int64_t lo, std::int64_t hi) {
+    return std::uniform_int_distribution<std::int64_t>(lo, hi)(rng);
+}
+
+inline double uniform_real(Rng& rng, double lo, double hi) {
+    return std::uniform_real_distribution<double>(lo, hi)(rng);
+}
+
+// --- K: wildcard matching ---------------------------------------------------
+// The pattern has m = sqrt(n) characters.
+// random    pattern over {a,b,?}, random text over {a,b}
+// periodic  text a^n and pattern a^m with one '?' in the middle: every
+//           position matches and the wildcard breaks Z-box reuse, so the
+//           extension scan degrades to O(n m)
+// nearmiss  text a^n, pattern a^(m-1)b: long extensions that all fail
+inline void gen_wildcard(const std::string& kind, int n, Rng& rng, fastio::Writer& out) {
+    int m = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(n))));
+    std::string pattern(m, 'a'), text(n, 'a');
+    if (kind == "random") {
+        for (auto& c : pattern) c = "ab?"[uniform(rng, 0, 2)];
+        for (auto& c : text) c = "ab"[uniform(rng, 0, 1)];
+    } else if (kind == "periodic") {
+        pattern[m / 2] = '?';
+    } else {
+        pattern[m - 1] = 'b';
+    }
+    out.write(pattern);
+    out.put('\n');
+    out.write(text);
+    out.put('\n');
+}
+
+// --- I: power series inverse ------------------------------------------------
+// pow2      q = 2^k terms (n rounded up), p of degree q - 1
+// pow2plus  q = 2^k + 1: the last doubling step covers a single coefficient
+inline void gen_polynomial(const std::string& kind, int n, Rng& rng, fastio::Writer& out) {
+    int q = 1;
+    while (q < n) q *= 2;
+    if (kind == "pow2plus") ++q;
+    int p = q - 1;
+    out.write(q);
+    out.put(' ');
+    out.write(p);
+    out.put('\n');
+    for (int i = 0; i <= p; ++i) {
+        if (i) out.put(' ');
+        out.write(uniform(rng, i ? 0 : 1, 7340032));
+    }
+    out.put('\n');
+}
+
+// --- D: Minkowski sum of two convex polygons --------------------------------
+// circle   both polygons have n vertices on circles, jittered angles
+// ellipse  flattened 1000:1 ellipses: near-parallel edges everywhere
+inline void gen_minkowski(const std::string& kind, int n, Rng& rng, fastio::Writer& out) {
+    const double pi = std::acos(-1.0);
+    double squash = kind == "ellipse" ? 1e-3 : 1.0;
+    auto polygon = [&](double cx, double cy, double r) {
+        double phase = uniform_real(rng, 0, 2 * pi);
+        for (int i = 0; i < n; ++i) {
+            double t = phase + 2 * pi * (i + uniform_real(rng, -0.25, 0.25)) / n;
+            out.write_fixed(cx + r * std::cos(t), 9);
+            out.put(' ');
+            out.write_fixed(cy + r * squash * std::sin(t), 9);
+            out.put('\n');
+        }
+    };
+    out.write(n);
+    out.put(' ');
+    out.write(n);
+    out.put('\n');
+    polygon(0, 0, 1e4);
+    polygon(uniform_real(rng, 2e4, 3e4), uniform_real(rng, -1e3, 1e3), 5e3);
+}
+
+// --- F: distance to a 3D hull -----------------------------------------------
+// ball          n points uniform in a ball
+// sphere        n points on a sphere: every point ends up on the hull
+// nearcoplanar  the ball squashed into a slab 1e-3 as thick as it is wide
+// Queries are n centroids of random point quadruples, so they lie inside.
+inline void gen_hull3d(const std::string& kind, int n, Rng& rng, fastio::Writer& out) {
+    std::vector<std::array<double, 3>> pts(n);
+    std::normal_distribution<double> gauss;
+    for (auto& p : pts) {
+        double x = gauss(rng), y = gauss(rng), z = gauss(rng);
+        double len = std::sqrt(x * x + y * y + z * z);
+        double r = kind == "sphere" ? 100.0 : 100.0 * std::cbrt(uniform_real(rng, 0, 1));
+        p = {r * x / len, r * y / len, r * z / len};
+        if (kind == "nearcoplanar") p[2] *= 1e-3;
+    }
+    auto write3 = [&out](const std::array<double, 3>& p) {
+        for (int c = 0; c < 3; ++c) {
+            if (c) out.put(' ');
+            out.write_fixed(p[c], 9);
+        }
+        out.put('\n');
+    };
+    out.write(n);
+    out.put('\n');
+    for (const auto& p : pts) write3(p);
+    out.write(n);
+    out.put('\n');
+    for (int i = 0; i < n; ++i) {
+        std::array<double, 3> q{};
+        for (int k = 0; k < 4; ++k) {
+            const auto& p = pts[uniform(rng, 0, n - 1)];
+            for (int c = 0; c < 3; ++c) q[c] += p[c] / 4;
+        }
+        write3(q);
+    }
+}
+
+// --- G: Voronoi cells in a rectangle ----------------------------------------
+// uniform    distinct integer sites uniform in a square of side ~ 30 sqrt(n)
+// clustered  sites in sqrt(n)/4 tight Gaussian clusters, dense and empty areas
+// lattice    a regular grid: four cocircular sites around every vertex
+inline void gen_voronoi(const std::string& kind, int n, Rng& rng, fastio::Writer& out) {
+    int side = std::max(4, static_cast<int>(30 * std::sqrt(static_cast<double>(n))));
+    std::vector<std::pair<int, int>> sites;
+    if (kind == "lattice") {
+        int k = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(n)))));
+        int step = std::max(1, side / k);
+        for (int i = 0; i < k && static_cast<int>(sites.size()) < n; ++i)
+            for (int j = 0; j < k && static_cast<int>(sites.size()) < n; ++j)
+                sites.push_back({i * step + step / 2, j * step + step / 2});
+    } else {
+        std::set<std::pair<int, int>> seen;
+        std::vector<std::pair<double, double>> centers;
+        int clusters = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(n)) / 4));
+        for (int c = 0; c < clusters; ++c)
+            centers.push_back({uniform_real(rng, 0, side), uniform_real(rng, 0, side)});
+        std::normal_distribution<double> gauss(0.0, side / (4.0 * clusters));
+        while (static_cast<int>(sites.size()) < n) {
+            int x, y;
+            if (kind == "clustered") {
+                const auto& c = centers[uniform(rng, 0, clusters - 1)];
+                x = static_cast<int>(std::lround(c.first + gauss(rng)));
+                y = static_cast<int>(std::lround(c.second + gauss(rng)));
+                if (x < 0 || x > side || y < 0 || y > side) continue;
+            } else {
+                x = static_cast<int>(uniform(rng, 0, side));
+                y = static_cast<int>(uniform(rng, 0, side));
+            }
+            if (seen.insert({x, y}).second) sites.push_back({x, y});
+        }
+    }
+    out.write(side);
+    out.put(' ');
+    out.write(side);
+    out.put(' ');
+    out.write(sites.size());
+    out.put('\n');
+    for (const auto& [x, y] : sites) {
+        out.write(x);
+        out.put(' ');
+        out.write(y);
+        out.put('\n');
+    }
+}
+
+// --- H: convex layers and depth queries -------------------------------------
+// uniform  n points uniform in a square, about n^(2/3) layers
+// rings    concentric 6-gons, one per 6 points: n / 6 layers
+// grid     a full lattice: heavy collinearity on every layer
+// Queries are n uniform points in a slightly larger square.
+inline void gen_layers(const std::string& kind, int n, Rng& rng, fastio::Writer& out) {
+    const double pi = std::acos(-1.0);
+    std::vector<std::pair<std::int64_t, std::int64_t>> pts;
+    std::int64_t R = 1000000;
+    if (kind == "rings") {
+        int rings = std::max(1, n / 6);
+        for (int r = 1; static_cast<int>(pts.size()) < n; ++r) {
+            double rad = static_cast<double>(R) * r / rings, phase = r * 0.1;
+            for (int i = 0; i < 6 && static_cast<int>(pts.size()) < n; ++i)
+                pts.push_back({std::llround(rad * std::cos(phase + pi * i / 3)),
+                               std::llround(rad * std::sin(phase + pi * i / 3))});
+        }
+    } else if (kind == "grid") {
+        int k = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(n)))));
+        for (int i = 0; i < k && static_cast<int>(pts.size()) < n; ++i)
+            for (int j = 0; j < k && static_cast<int>(pts.size()) < n; ++j)
+                pts.push_back({R * (2 * i - k) / k, R * (2 * j - k) / k});
+    } else {
+        for (int i = 0; i < n; ++i) pts.push_back({uniform(rng, -R, R), uniform(rng, -R, R)});
+    }
+    auto write_points = [&out](const std::vector<std::pair<std::int64_t, std::int64_t>>& v) {
+        out.write(v.size());
+        out.put('\n');
+        for (const auto& [x, y] : v) {
+            out.write(x);
+            out.put(' ');
+            out.write(y);
+            out.put('\n');
+        }
+    };
+    write_points(pts);
+    std::vector<std::pair<std::int64_t, std::int64_t>> queries(n);
+    for (auto& q : queries) q = {uniform(rng, -R - R / 10, R + R / 10), uniform(rng, -R - R / 10, R + R / 10)};
+    write_points(queries);
+}
+
+}  // namespace bench
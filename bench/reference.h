@@ -0,0 +1,248 @@
+// bench/reference.h
+// Straightforward reference implementations used to check the fast paths on
+// small inputs. They share no code with the task headers beyond the onion
+// point type and its cross / on_segment / inside_convex primitives; the hull
+// and the peeling are kept here so a bug in the fast hull cannot hide in both.
+// Every function here is quadratic or worse; keep n small.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "convex_layers.h"
+
+namespace bench::naive {
+
+// --- K ----------------------------------------------------------------------
+inline std::vector<int> wildcard_matches(const std::string& pattern, const std::string& text) {
+    std::vector<int> res;
+    int n = static_cast<int>(text.size()), m = static_cast<int>(pattern.size());
+    for (int pos = 0; pos + m <= n; ++pos) {
+        int k = 0;
+        while (k < m && (pattern[k] == '?' || pattern[k] == text[pos + k])) ++k;
+        if (k == m) res.push_back(pos);
+    }
+    return res;
+}
+
+// --- I ----------------------------------------------------------------------
+// First q coefficients of 1 / P(x) mod 7340033 by the schoolbook recurrence;
+// empty if P(0) = 0.
+inline std::vector<int> series_inverse(int q, const std::vector<int>& p) {
+    const std::int64_t mod = 7340033;
+    if (p.empty() || p[0] % mod == 0) return {};
+    auto power = [mod](std::int64_t b, std::int64_t e) {
+        std::int64_t r = 1;
+        for (b %= mod; e; e >>= 1, b = b * b % mod)
+            if (e & 1) r = r * b % mod;
+        return r;
+    };
+    std::int64_t inv0 = power(p[0], mod - 2);
+    std::vector<int> res(q);
+    for (int k = 0; k < q; ++k) {
+        std::int64_t s = k ? 0 : 1;
+        for (int i = 1; i <= k && i < static_cast<int>(p.size()); ++i)
+            s = (s - static_cast<std::int64_t>(p[i]) * res[k - i]) % mod;
+        res[k] = static_cast<int>((s % mod + mod) % mod * inv0 % mod);
+    }
+    return res;
+}
+
+// --- D ----------------------------------------------------------------------
+struct Point2 {
+    long double x, y;
+};
+
+// Hull of all pairwise sums A + (-B), then the same distance rule as the task.
+inline long double minkowski_answer(const std::vector<Point2>& A, const std::vector<Point2>& B) {
+    std::vector<Point2> sums;
+    sums.reserve(A.size() * B.size());
+    for (const auto& a : A)
+        for (const auto& b : B) sums.push_back({a.x - b.x, a.y - b.y});
+    std::sort(sums.begin(), sums.end(), [](const Point2& a, const Point2& b) {
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+    });
+    auto cross = [](const Point2& o, const Point2& a, const Point2& b) {
+        return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+    };
+    std::vector<Point2> hull(2 * sums.size());
+    int k = 0;
+    for (std::size_t i = 0; i < sums.size(); ++i) {
+        while (k >= 2 && cross(hull[k - 2], hull[k - 1], sums[i]) <= 0) --k;
+        hull[k++] = sums[i];
+    }
+    for (int i = static_cast<int>(sums.size()) - 2, t = k + 1; i >= 0; --i) {
+        while (k >= t && cross(hull[k - 2], hull[k - 1], sums[i]) <= 0) --k;
+        hull[k++] = sums[i];
+    }
+    hull.resize(k - 1);
+
+    long double best = 1e100L;
+    for (std::size_t i = 0; i < hull.size(); ++i) {
+        const auto& a = hull[i];
+        const auto& b = hull[(i + 1) % hull.size()];
+        long double area2 = std::fabs(a.x * b.y - a.y * b.x);
+        best = std::min(best, area2 / std::hypot(b.x - a.x, b.y - a.y));
+    }
+    return best <= 60.0L + 1e-12L ? 0.0L : best - 60.0L;
+}
+
+// --- F ----------------------------------------------------------------------
+using Vec3 = std::array<double, 3>;
+
+// Every non-degenerate triple that has all points on one side is a supporting
+// plane; the distance from an inner point to the hull is the minimum over them.
+inline std::vector<double> hull_distances(const std::vector<Vec3>& pts,
+                                          const std::vector<Vec3>& queries) {
+    struct Plane {
+        Vec3 n;
+        double d;
+    };
+    std::vector<Plane> planes;
+    int n = static_cast<int>(pts.size());
+    auto sub = [](const Vec3& a, const Vec3& b) { return Vec3{a[0] - b[0], a[1] - b[1], a[2] - b[2]}; };
+    auto dot = [](const Vec3& a, const Vec3& b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; };
+    for (int i = 0; i < n; ++i)
+        for (int j = i + 1; j < n; ++j)
+            for (int k = j + 1; k < n; ++k) {
+                Vec3 u = sub(pts[j], pts[i]), v = sub(pts[k], pts[i]);
+                Vec3 nv{u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]};
+                double len = std::sqrt(dot(nv, nv));
+                if (len < 1e-9) continue;
+                for (auto& c : nv) c /= len;
+                double d = -dot(nv, pts[i]);
+                bool pos = false, neg = false;
+                for (const auto& p : pts) {
+                    double s = dot(nv, p) + d;
+                    pos |= s > 1e-9;
+                    neg |= s < -1e-9;
+                }
+                if (pos && neg) continue;
+                if (pos) {
+                    for (auto& c : nv) c = -c;
+                    d = -d;
+                }
+                planes.push_back({nv, d});
+            }
+    std::vector<double> res;
+    for (const auto& q : queries) {
+        double best = std::numeric_limits<double>::max();
+        for (const auto& pl : planes) best = std::min(best, -(dot(pl.n, q) + pl.d));
+        res.push_back(best);
+    }
+    return res;
+}
+
+// --- G ----------------------------------------------------------------------
+// Cell areas: the rectangle clipped by the bisector with every other site.
+inline std::vector<double> voronoi_areas(double X, double Y,
+                                         const std::vector<std::array<double, 2>>& sites) {
+    using P = std::array<double, 2>;
+    std::vector<double> res;
+    std::vector<P> poly, next;
+    for (std::size_t i = 0; i < sites.size(); ++i) {
+        poly = {{0, 0}, {X, 0}, {X, Y}, {0, Y}};
+        const P& s = sites[i];
+        for (std::size_t j = 0; j < sites.size() && !poly.empty(); ++j) {
+            if (j == i) continue;
+            const P& t = sites[j];
+            // keep |x - s| <= |x - t|:  2 (t - s) . x <= |t|^2 - |s|^2
+            double a = 2 * (t[0] - s[0]), b = 2 * (t[1] - s[1]);
+            double c = t[0] * t[0] + t[1] * t[1] - s[0] * s[0] - s[1] * s[1];
+            auto f = [&](const P& p) { return a * p[0] + b * p[1] - c; };
+            next.clear();
+            for (std::size_t k = 0; k < poly.size(); ++k) {
+                const P& u = poly[k];
+                const P& v = poly[(k + 1) % poly.size()];
+                double fu = f(u), fv = f(v);
+                if (fu <= 0) next.push_back(u);
+                if ((fu < 0) != (fv < 0) && fu != fv) {
+                    double r = fu / (fu - fv);
+                    next.push_back({u[0] + r * (v[0] - u[0]), u[1] + r * (v[1] - u[1])});
+                }
+            }
+            poly.swap(next);
+        }
+        double area = 0;
+        for (std::size_t k = 0; k < poly.size(); ++k) {
+            const P& u = poly[k];
+            const P& v = poly[(k + 1) % poly.size()];
+            area += u[0] * v[1] - u[1] * v[0];
+        }
+        res.push_back(std::fabs(area) / 2);
+    }
+    return res;
+}
+
+// --- H ----------------------------------------------------------------------
+// Strict hull with separate lower and upper chains, as the original driver
+// built it; sorts and deduplicates pts in place.
+inline std::vector<onion::Point> convex_hull(std::vector<onion::Point>& pts) {
+    using onion::Point;
+    std::sort(pts.begin(), pts.end(), onion::cmp_xy);
+    pts.erase(std::unique(pts.begin(), pts.end(),
+                          [](const Point& p, const Point& q) { return p.x == q.x && p.y == q.y; }),
+              pts.end());
+    int n = static_cast<int>(pts.size());
+    if (n <= 1) return pts;
+    std::vector<Point> lower, upper;
+    for (const auto& p : pts) {
+        while (lower.size() >= 2 && onion::cross(lower[lower.size() - 2], lower.back(), p) <= 0)
+            lower.pop_back();
+        lower.push_back(p);
+    }
+    for (int i = n - 1; i >= 0; --i) {
+        const auto& p = pts[i];
+        while (upper.size() >= 2 && onion::cross(upper[upper.size() - 2], upper.back(), p) <= 0)
+            upper.pop_back();
+        upper.push_back(p);
+    }
+    lower.pop_back();
+    upper.pop_back();
+    lower.insert(lower.end(), upper.begin(), upper.end());
+    return lower;
+}
+
+// Peel hulls one by one; points on a hull's edges leave with it.
+inline std::vector<std::vector<onion::Point>> peel_layers(const std::vector<onion::Point>& src) {
+    std::vector<onion::Point> rest = src;
+    std::vector<std::vector<onion::Point>> layers;
+    while (!rest.empty()) {
+        std::vector<onion::Point> hull = rest.size() >= 3 ? naive::convex_hull(rest) : rest;
+        int m = static_cast<int>(hull.size());
+        std::vector<onion::Point> next;
+        for (const auto& p : rest) {
+            bool on_hull = false;
+            for (int i = 0; i < m && !on_hull; ++i)
+                on_hull = (hull[i].x == p.x && hull[i].y == p.y) ||
+                          (m >= 2 && onion::on_segment(hull[i], hull[(i + 1) % m], p));
+            if (!on_hull) next.push_back(p);
+        }
+        layers.push_back(std::move(hull));
+        rest.swap(next);
+    }
+    return layers;
+}
+
+// Depth as the original driver computed it: the last layer of the naive
+// peeling that still contains q, scanning outwards in.
+inline std::vector<int> layer_depths(const std::vector<onion::Point>& pts,
+                                     const std::vector<onion::Point>& queries) {
+    auto layers = peel_layers(pts);
+    std::vector<int> res;
+    for (const auto& q : queries) {
+        int zone = 0;
+        for (std::size_t i = 0; i < layers.size() && onion::inside_convex(layers[i], q); ++i)
+            zone = static_cast<int>(i);
+        res.push_back(zone);
+    }
+    return res;
+}
+
+}  // namespace bench::naive
@@ -0,0 +1,843 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <thread>
+
+#include "fast_io.h"
+#include "instrument.h"
+#include "parallel.h"
+
+namespace onion {
+
+struct Point {
+    std::int64_t x;
+    std::int64_t y;
+};
+
+using i128 = __int128_t;
+
+inline i128 cross(const Point& a, const Point& b, const Point& c) {
+    return static_cast<i128>(b.x - a.x) * (c.y - a.y) -
+           static_cast<i128>(b.y - a.y) * (c.x - a.x);
+}
+
+inline bool cmp_xy(const Point& a, const Point& b) {
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+inline bool on_segment(const Point& a, const Point& b, const Point& q) {
+    if (cross(a, b, q) != 0) return false;
+    return (q.x - a.x) * (q.x - b.x) <= 0 &&
+           (q.y - a.y) * (q.y - b.y) <= 0;
+}
+
+inline bool same(const Point& p, const Point& q) { return p.x == q.x && p.y == q.y; }
+
+// Векторное произведение в типе T. Для int64 нужно, чтобы разности координат
+// укладывались в 31 бит: тогда произведения меньше 2^62.
+template <class T>
+inline T cross_as(const Point& a, const Point& b, const Point& c) {
+    return static_cast<T>(b.x - a.x) * (c.y - a.y) -
+           static_cast<T>(b.y - a.y) * (c.x - a.x);
+}
+
+inline bool small_range(std::int64_t lo, std::int64_t hi) {
+    return static_cast<std::uint64_t>(hi) - static_cast<std::uint64_t>(lo) < (1ull << 31);
+}
+
+// Сортировка в порядке cmp_xy: куски сортируются параллельно, потом
+// сливаются попарно через второй буфер, пары одного раунда — тоже параллельно.
+inline void sort_xy(std::vector<Point>& v, int threads = 1) {
+    const int kMinChunk = 1 << 15;
+    int n = static_cast<int>(v.size());
+    threads = std::max(1, std::min(threads, n / kMinChunk));
+    if (threads == 1) {
+        std::sort(v.begin(), v.end(), cmp_xy);
+        return;
+    }
+    std::vector<int> bound(threads + 1);
+    for (int t = 0; t <= threads; ++t) bound[t] = static_cast<int>(1LL * n * t / threads);
+    par::run(threads, [&](int t) {
+        std::sort(v.begin() + bound[t], v.begin() + bound[t + 1], cmp_xy);
+    });
+    std::vector<Point> buf(n);
+    Point* src = v.data();
+    Point* dst = buf.data();
+    for (int w = 1; w < threads; w *= 2) {
+        par::run((threads + 2 * w - 1) / (2 * w), [&, w](int j) {
+            int lo = bound[2 * w * j];
+            int mid = bound[std::min(threads, 2 * w * j + w)];
+            int hi = bound[std::min(threads, 2 * w * (j + 1))];
+            std::merge(src + lo, src + mid, src + mid, src + hi, dst + lo, cmp_xy);
+        });
+        std::swap(src, dst);
+    }
+    if (src != v.data()) v.swap(buf);
+}
+
+// Цепь Эндрю по точкам в порядке cmp_xy без повторов в один буфер h, место
+// под который выделено заранее: нижняя цепь, затем верхняя поверх неё.
+// Остаётся строгая оболочка (коллинеарные отбрасываются), n >= 2.
+template <class T>
+inline void monotone_chain(const Point* p, int n, std::vector<Point>& h) {
+    h.clear();
+    for (int i = 0; i < n; ++i) {
+        while (h.size() >= 2 && cross_as<T>(h[h.size() - 2], h.back(), p[i]) <= 0) h.pop_back();
+        h.push_back(p[i]);
+    }
+    for (std::size_t i = n - 1, t = h.size() + 1; i-- > 0;) {
+        while (h.size() >= t && cross_as<T>(h[h.size() - 2], h.back(), p[i]) <= 0) h.pop_back();
+        h.push_back(p[i]);
+    }
+    h.pop_back();
+}
+
+// Строгая оболочка отсортированных точек без повторов, против часовой
+// стрелки от лексикографического минимума.
+inline void hull_sorted(const Point* p, int n, std::vector<Point>& out) {
+    if (n <= 1) {
+        out.assign(p, p + n);
+        return;
+    }
+    std::int64_t y0 = p[0].y, y1 = p[0].y;
+    for (int i = 1; i < n; ++i) {
+        y0 = std::min(y0, p[i].y);
+        y1 = std::max(y1, p[i].y);
+    }
+    out.reserve(n + 1);
+    if (small_range(p[0].x, p[n - 1].x) && small_range(y0, y1))
+        monotone_chain<std::int64_t>(p, n, out);
+    else
+        monotone_chain<i128>(p, n, out);
+}
+
+// Строгая оболочка набора с повторами, src не меняется. Сначала фильтр
+// Экла–Туссена: крайние точки по x, y, x + y и x - y образуют вписанный
+// восьмиугольник, и всё, что строго внутри него, не может быть вершиной. Остаток сортируется параллельно. Фильтр считает в сдвинутых
+// координатах, поэтому включается, только когда разброс укладывается в 31 бит.
+inline std::vector<Point> fast_hull(const std::vector<Point>& src, int threads = 1) {
+    int n = static_cast<int>(src.size());
+    std::vector<Point> pts;
+    if (n) {
+        std::int64_t x0 = src[0].x, x1 = x0, y0 = src[0].y, y1 = y0;
+        for (const auto& p : src) {
+            x0 = std::min(x0, p.x); x1 = std::max(x1, p.x);
+            y0 = std::min(y0, p.y); y1 = std::max(y1, p.y);
+        }
+        if (small_range(x0, x1) && small_range(y0, y1)) {
+            // крайние по -y, x - y, x, x + y, y, y - x, -x, -x - y: по кругу
+            // против часовой стрелки, как и соответствующие им вершины
+            Point ext[8];
+            std::int64_t best[8];
+            std::fill(ext, ext + 8, src[0]);
+            std::fill(best, best + 8, std::numeric_limits<std::int64_t>::min());
+            for (const auto& p : src) {
+                std::int64_t x = p.x - x0, y = p.y - y0;
+                const std::int64_t v[8] = {-y, x - y, x, x + y, y, y - x, -x, -x - y};
+                for (int d = 0; d < 8; ++d)
+                    if (v[d] > best[d]) best[d] = v[d], ext[d] = p;
+            }
+            Point oct[9];
+            int m = 0;
+            for (int d = 0; d < 8; ++d)
+                if (!m || !same(oct[m - 1], ext[d])) oct[m++] = ext[d];
+            while (m > 1 && same(oct[m - 1], oct[0])) --m;
+            oct[m] = oct[0];
+            pts.reserve(n);
+            for (const auto& p : src) {
+                bool inside = m >= 3;
+                for (int i = 0; i < m && inside; ++i)
+                    inside = cross_as<std::int64_t>(oct[i], oct[i + 1], p) > 0;
+                if (!inside) pts.push_back(p);
+            }
+            ALGOS_COUNT("onion.hull_filtered", n - static_cast<int>(pts.size()));
+        } else {
+            pts = src;
+        }
+    }
+    sort_xy(pts, threads);
+    pts.erase(std::unique(pts.begin(), pts.end(), same), pts.end());
+    std::vector<Point> hull;
+    hull_sorted(pts.data(), static_cast<int>(pts.size()), hull);
+    return hull;
+}
+
+inline bool inside_convex(const Point* P, int n, const Point& q) {
+    if (n == 0) return false;
+    if (n == 1) return P[0].x == q.x && P[0].y == q.y;
+    if (n == 2) return on_segment(P[0], P[1], q);
+    if (cross(P[0], P[1], q) < 0) return false;
+    if (cross(P[0], P[n - 1], q) > 0) return false;
+    int l = 1, r = n - 1;
+    while (r - l > 1) {
+        int m = (l + r) >> 1;
+        if (cross(P[0], P[m], q) >= 0)
+            l = m;
+        else
+            r = m;
+    }
+    return cross(P[l], P[r % n], q) >= 0;
+}
+
+inline bool inside_convex(const std::vector<Point>& P, const Point& q) {
+    return inside_convex(P.data(), static_cast<int>(P.size()), q);
+}
+
+// Нижняя цепь (обход выпуклой оболочки против часовой стрелки от
+// лексикографического минимума до максимума, без коллинеарных вершин) для
+// множества точек с удалениями. Дерево отрезков над точками в порядке
+// (x, y); в узле хранится мост между цепями детей, сами цепи неявные.
+// Мост ищется одновременным спуском по детям за O(log n), удаление —
+// O(log^2 n). Координаты — до ~2^31 по модулю, как и в on_segment.
+class HullTree {
+public:
+    explicit HullTree(std::vector<Point> pts) : p_(std::move(pts)) {
+        n_ = static_cast<int>(p_.size());
+        size_ = 1;
+        while (size_ < n_) size_ <<= 1;
+        node_.assign(2 * size_, Node{});
+        mark_.assign(2 * size_, 0);
+        cnt_.assign(2 * size_, 0);
+        for (int i = 0; i < n_; ++i) cnt_[size_ + i] = 1;
+        for (int v = size_ - 1; v >= 1; --v) pull(v);
+    }
+
+    int size() const { return cnt_[1]; }
+    bool alive(int i) const { return cnt_[size_ + i] != 0; }
+
+    // Удаляет пачку точек. Мост остаётся мостом подмножества, пока живы оба
+    // его конца, поэтому пересчитываются только узлы, чей мост задевает
+    // удалённая точка, — снизу вверх, чтобы мосты детей были уже верны.
+    void erase(const std::vector<int>& ids) {
+        ++stamp_;
+        dirty_.clear();
+        for (int i : ids) {
+            if (!cnt_[size_ + i]) continue;
+            cnt_[size_ + i] = 0;
+            for (int v = (size_ + i) >> 1; v >= 1; v >>= 1) {
+                Node& x = node_[v];
+                --cnt_[v];
+                if ((x.bl == i || x.br == i) && mark_[v] != stamp_) {
+                    mark_[v] = stamp_;
+                    dirty_.push_back(v);
+                }
+            }
+        }
+        std::sort(dirty_.begin(), dirty_.end(), std::greater<int>());
+        for (int v : dirty_)
+            if (cnt_[2 * v] && cnt_[2 * v + 1]) bridge(v);
+        ALGOS_COUNT("onion.erase_batches", 1);
+        ALGOS_COUNT("onion.bridge_recomputes", dirty_.size());
+    }
+
+    void chain(std::vector<int>& out) const {
+        if (size()) chain(1, 0, n_ - 1, out);
+    }
+
+    // вершина цепи с минимальным cross(a, b, ·): самая левая или самая правая
+    int extreme(const Point& a, const Point& b, bool leftmost) const {
+        int v = down(1);
+        std::int64_t dx = b.x - a.x, dy = b.y - a.y;
+        while (v < size_) {
+            const Node& x = node_[v];
+            i128 t = static_cast<i128>(dx) * (x.b.y - x.a.y) -
+                     static_cast<i128>(dy) * (x.b.x - x.a.x);
+            v = down((t > 0 || (t == 0 && leftmost)) ? 2 * v : 2 * v + 1);
+        }
+        return v - size_;
+    }
+
+private:
+    struct Node {
+        int bl = -1, br = -1;
+        Point a{}, b{};
+    };
+
+    int first(int v) const {
+        while (v < size_) v <<= 1;
+        return v - size_;
+    }
+
+    int down(int v) const {
+        while (v < size_ && (!cnt_[2 * v] || !cnt_[2 * v + 1]))
+            v = cnt_[2 * v] ? 2 * v : 2 * v + 1;
+        return v;
+    }
+
+    void pull(int v) {
+        cnt_[v] = cnt_[2 * v] + cnt_[2 * v + 1];
+        if (cnt_[2 * v] && cnt_[2 * v + 1]) bridge(v);
+    }
+
+    // лежит ли точка пересечения прямых (a1,a2) и (b1,b2) лексикографически
+    // раньше s; прямая (a1,a2) не вертикальна
+    static bool apex_before(const Point& a1, const Point& a2, const Point& b1,
+                            const Point& b2, const Point& s) {
+        i128 cu = cross(a1, a2, s);
+        std::int64_t dxu = a2.x - a1.x, dxw = b2.x - b1.x;
+        if (dxw == 0) {
+            if (b1.x != s.x) return b1.x < s.x;
+            return cu > 0;
+        }
+        i128 cw = cross(b1, b2, s);
+        i128 lhs = cw * dxu, rhs = cu * dxw;
+        if (lhs != rhs) return lhs < rhs;
+        return cu > 0;
+    }
+
+    // Мост между цепями детей v. Курсоры u и w спускаются по левому и
+    // правому поддеревьям; мост узла-курсора — ребро цепи его множества,
+    // и по нему видно, в какой половине лежит конец искомого моста.
+    void bridge(int v) {
+        const Point& s = p_[first(2 * v + 1)];
+        int u = down(2 * v), w = down(2 * v + 1);
+        while (u < size_ || w < size_) {
+            if (u >= size_) {
+                const Point& a = p_[u - size_];
+                const Node& y = node_[w];
+                w = down(cross(y.a, y.b, a) > 0 ? 2 * w : 2 * w + 1);
+            } else if (w >= size_) {
+                const Point& b = p_[w - size_];
+                const Node& x = node_[u];
+                u = down(cross(x.a, x.b, b) <= 0 ? 2 * u : 2 * u + 1);
+            } else {
+                const Node& x = node_[u];
+                const Node& y = node_[w];
+                if (cross(x.a, x.b, y.a) <= 0 || cross(x.a, x.b, y.b) <= 0)
+                    u = down(2 * u);
+                else if (cross(y.a, y.b, x.a) <= 0 || cross(y.a, y.b, x.b) <= 0)
+                    w = down(2 * w + 1);
+                else if (apex_before(x.a, x.b, y.a, y.b, s))
+                    u = down(2 * u + 1);
+                else
+                    w = down(2 * w);
+            }
+        }
+        Node& x = node_[v];
+        x.bl = u - size_;
+        x.br = w - size_;
+        x.a = p_[x.bl];
+        x.b = p_[x.br];
+    }
+
+    void chain(int v, int lo, int hi, std::vector<int>& out) const {
+        v = down(v);
+        if (v >= size_) {
+            int i = v - size_;
+            if (lo <= i && i <= hi) out.push_back(i);
+            return;
+        }
+        const Node& x = node_[v];
+        if (lo <= x.bl) chain(2 * v, lo, std::min(hi, x.bl), out);
+        if (x.br <= hi) chain(2 * v + 1, std::max(lo, x.br), hi, out);
+    }
+
+    std::vector<Point> p_;
+    int n_, size_;
+    std::vector<int> cnt_;
+    std::vector<Node> node_;
+    std::vector<int> mark_, dirty_;
+    int stamp_ = 0;
+};
+
+// Послойное снятие оболочек за O(n log^2 n): нижняя цепь слоя берётся из
+// дерева над точками, верхняя — из дерева над точками, отражёнными
+// относительно начала координат. После удаления вершин слоя точки, лежащие
+// на его рёбрах, находятся как минимум cross по ребру и тоже удаляются.
+// Слои совпадают с наивным снятием из bench/reference.h, включая
+// вырожденные случаи.
+inline std::vector<std::vector<Point>> build_layers(const std::vector<Point>& src,
+                                                    int threads = 1) {
+    if (src.size() < 3) {
+        if (src.empty()) return {};
+        return {src};
+    }
+    std::vector<Point> pts = src;
+    sort_xy(pts, threads);
+    pts.erase(std::unique(pts.begin(), pts.end(), same), pts.end());
+    int n = static_cast<int>(pts.size());
+    std::vector<Point> refl(n);
+    for (int i = 0; i < n; ++i) refl[i] = {-pts[n - 1 - i].x, -pts[n - 1 - i].y};
+    HullTree lower(pts), upper(refl);
+
+    std::vector<int> del, del_refl;
+    auto erase = [&]() {
+        del_refl.clear();
+        for (int i : del) del_refl.push_back(n - 1 - i);
+        lower.erase(del);
+        upper.erase(del_refl);
+        del.clear();
+    };
+    auto peel_edge = [&](const HullTree& t, const std::vector<Point>& q,
+                         int a, int b, bool refl_idx) {
+        while (t.size()) {
+            int l = t.extreme(q[a], q[b], true);
+            if (cross(q[a], q[b], q[l]) != 0) break;
+            int r = t.extreme(q[a], q[b], false);
+            del.push_back(refl_idx ? n - 1 - l : l);
+            if (r != l) del.push_back(refl_idx ? n - 1 - r : r);
+            erase();
+        }
+    };
+
+    std::vector<std::vector<Point>> layers;
+    std::vector<int> lo, up;
+    while (lower.size() >= 3) {
+        lo.clear();
+        up.clear();
+        lower.chain(lo);
+        upper.chain(up);
+        std::vector<Point> hull;
+        hull.reserve(lo.size() + up.size());
+        for (int i : lo) hull.push_back(pts[i]);
+        for (std::size_t k = 1; k + 1 < up.size(); ++k)
+            hull.push_back(pts[n - 1 - up[k]]);
+        layers.push_back(std::move(hull));
+
+        del.assign(lo.begin(), lo.end());
+        for (std::size_t k = 1; k + 1 < up.size(); ++k) del.push_back(n - 1 - up[k]);
+        erase();
+        for (std::size_t k = 0; k + 1 < lo.size(); ++k)
+            peel_edge(lower, pts, lo[k], lo[k + 1], false);
+        for (std::size_t k = 0; k + 1 < up.size(); ++k)
+            peel_edge(upper, refl, up[k], up[k + 1], true);
+    }
+    if (lower.size()) {
+        std::vector<Point> rest;
+        for (int i = 0; i < n; ++i)
+            if (lower.alive(i)) rest.push_back(pts[i]);
+        layers.push_back(std::move(rest));
+    }
+    ALGOS_COUNT("onion.layers", layers.size());
+    return layers;
+}
+
+// Глубина точки в луковице слоёв. Слои вложены, поэтому принадлежность
+// монотонна по номеру слоя и номер последнего содержащего слоя ищется
+// двоичным поиском; узел дерева поиска — сам слой (середина отрезка).
+// Внутри слоя точка проверяется по x: ребро нижней и верхней цепей над
+// q.x. Позиции q.x в слоях на пути поиска протягиваются дробным каскадом:
+// в каталог узла входит каждый второй ключ каталогов детей, поэтому в
+// ребёнке позиция уточняется за O(1). Запрос — O(log n + log L).
+// Все слои, каталоги и каскады лежат в плоских массивах со смещениями.
+class LayerIndex {
+public:
+    explicit LayerIndex(const std::vector<std::vector<Point>>& layers) {
+        int L = static_cast<int>(layers.size());
+        off_.assign(L + 1, 0);
+        top_.assign(L, 0);
+        cat_off_.assign(L + 1, 0);
+        aug_beg_.assign(L, 0);
+        aug_end_.assign(L, 0);
+        left_.assign(L, -1);
+        right_.assign(L, -1);
+        ends_.assign(L, {});
+        for (int i = 0; i < L; ++i) {
+            pts_.insert(pts_.end(), layers[i].begin(), layers[i].end());
+            off_[i + 1] = static_cast<int>(pts_.size());
+            if (layers[i].size() >= 3) build_catalog(i);
+            cat_off_[i + 1] = static_cast<int>(keys_.size());
+        }
+        root_ = build(0, L);
+    }
+
+    int depth(const Point& q) const {
+        int v = root_, ans = -1;
+        if (v < 0) return 0;
+        const Aug* a = aug_.data() + aug_beg_[v];
+        int len = aug_len(v);
+        int pos = static_cast<int>(
+            std::lower_bound(a, a + len, q.x,
+                             [](const Aug& e, std::int64_t x) { return e.key < x; }) - a);
+        while (v >= 0) {
+            int native = pos < len ? a[pos].native : cat_off_[v + 1] - cat_off_[v];
+            bool in = inside(v, native, q);
+            if (in) ans = v;
+            int c = in ? right_[v] : left_[v];
+            if (c < 0) break;
+            int clen = aug_len(c);
+            int ptr = pos < len ? (in ? a[pos].rptr : a[pos].lptr) : clen;
+            a = aug_.data() + aug_beg_[c];
+            if (ptr > 0 && a[ptr - 1].key >= q.x) --ptr;
+            v = c;
+            len = clen;
+            pos = ptr;
+        }
+        return ans < 0 ? 0 : ans;
+    }
+
+private:
+    struct Aug {
+        std::int64_t key;
+        int native, lptr, rptr;
+    };
+    // вертикальные отрезки слоя на x = min и x = max
+    struct Ends {
+        std::int64_t lo_min, hi_min, lo_max, hi_max;
+    };
+
+    int size(int i) const { return off_[i + 1] - off_[i]; }
+    int aug_len(int v) const { return aug_end_[v] - aug_beg_[v]; }
+
+    // нижняя цепь — вершины 0..top_, верхняя по возрастанию x — sz, sz-1, ..., top_
+    const Point& lower(int i, int t) const { return pts_[off_[i] + t]; }
+    const Point& upper(int i, int t) const {
+        int sz = size(i);
+        return pts_[off_[i] + (sz - t) % sz];
+    }
+
+    void build_catalog(int i) {
+        int sz = size(i), top = 0;
+        for (int t = 1; t < sz; ++t)
+            if (cmp_xy(pts_[off_[i] + top], pts_[off_[i] + t])) top = t;
+        top_[i] = top;
+        int nl = top + 1, nu = sz - top + 1;
+        Ends& e = ends_[i];
+        e.lo_min = lower(i, 0).y;
+        e.hi_min = lower(i, 0).y;
+        for (int t = 1; t < nu && upper(i, t).x == lower(i, 0).x; ++t)
+            e.hi_min = upper(i, t).y;
+        e.hi_max = lower(i, top).y;
+        e.lo_max = lower(i, top).y;
+        for (int t = top - 1; t >= 0 && lower(i, t).x == lower(i, top).x; --t)
+            e.lo_max = lower(i, t).y;
+
+        int a = 0, b = 0;
+        while (a < nl || b < nu) {
+            std::int64_t x = (b == nu || (a < nl && lower(i, a).x <= upper(i, b).x))
+                                 ? lower(i, a).x
+                                 : upper(i, b).x;
+            keys_.push_back(x);
+            low_.push_back(a);
+            up_.push_back(b);
+            while (a < nl && lower(i, a).x == x) ++a;
+            while (b < nu && upper(i, b).x == x) ++b;
+        }
+    }
+
+    bool inside(int i, int native, const Point& q) const {
+        int sz = size(i);
+        if (sz < 3) return inside_convex(pts_.data() + off_[i], sz, q);
+        int nk = cat_off_[i + 1] - cat_off_[i];
+        if (native == nk) return false;
+        const Ends& e = ends_[i];
+        if (native == 0) {
+            if (keys_[cat_off_[i]] != q.x) return false;
+            return e.lo_min <= q.y && q.y <= e.hi_min;
+        }
+        if (q.x == lower(i, top_[i]).x) return e.lo_max <= q.y && q.y <= e.hi_max;
+        int j = low_[cat_off_[i] + native], k = up_[cat_off_[i] + native];
+        return cross(lower(i, j - 1), lower(i, j), q) >= 0 &&
+               cross(upper(i, k - 1), upper(i, k), q) <= 0;
+    }
+
+    int build(int lo, int hi) {
+        if (lo >= hi) return -1;
+        int v = (lo + hi) / 2;
+        int l = left_[v] = build(lo, v);
+        int r = right_[v] = build(v + 1, hi);
+
+        std::vector<std::int64_t> ks(keys_.begin() + cat_off_[v],
+                                     keys_.begin() + cat_off_[v + 1]);
+        std::vector<std::int64_t> ls, rs, merged;
+        for (int t = 1; l >= 0 && t < aug_len(l); t += 2) ls.push_back(aug_[aug_beg_[l] + t].key);
+        for (int t = 1; r >= 0 && t < aug_len(r); t += 2) rs.push_back(aug_[aug_beg_[r] + t].key);
+        std::merge(ks.begin(), ks.end(), ls.begin(), ls.end(), std::back_inserter(merged));
+        ls.clear();
+        std::merge(merged.begin(), merged.end(), rs.begin(), rs.end(), std::back_inserter(ls));
+
+        int a = 0, b = 0, c = 0;
+        int nk = static_cast<int>(ks.size());
+        int nl = l >= 0 ? aug_len(l) : 0, nr = r >= 0 ? aug_len(r) : 0;
+        std::vector<Aug> cur;
+        cur.reserve(ls.size());
+        for (std::int64_t x : ls) {
+            while (a < nk && ks[a] < x) ++a;
+            while (b < nl && aug_[aug_beg_[l] + b].key < x) ++b;
+            while (c < nr && aug_[aug_beg_[r] + c].key < x) ++c;
+            cur.push_back({x, a, b, c});
+        }
+        aug_beg_[v] = static_cast<int>(aug_.size());
+        aug_.insert(aug_.end(), cur.begin(), cur.end());
+        aug_end_[v] = static_cast<int>(aug_.size());
+        return v;
+    }
+
+    std::vector<Point> pts_;
+    std::vector<int> off_, top_;
+    std::vector<Ends> ends_;
+    std::vector<std::int64_t> keys_;
+    std::vector<int> low_, up_, cat_off_;
+    std::vector<Aug> aug_;
+    std::vector<int> aug_beg_, aug_end_, left_, right_;
+    int root_ = -1;
+};
+
+// Один шаг снятия для точек в порядке cmp_xy без повторов: строгая оболочка
+// (как у hull_sorted), точки на её границе и внутренние точки.
+inline void peel_once(const std::vector<Point>& pts, std::vector<Point>& hull,
+               std::vector<Point>& boundary, std::vector<Point>& inner) {
+    int n = static_cast<int>(pts.size());
+    hull.clear();
+    boundary.clear();
+    inner.clear();
+    if (n <= 2) {
+        hull = pts;
+        boundary = pts;
+        return;
+    }
+    hull_sorted(pts.data(), n, hull);
+
+    std::vector<char> on(n, 0);
+    std::vector<int> chain;
+    for (int pass = 0; pass < 2; ++pass) {
+        chain.clear();
+        for (int k = 0; k < n; ++k) {
+            int i = pass ? n - 1 - k : k;
+            while (chain.size() >= 2 &&
+                   cross(pts[chain[chain.size() - 2]], pts[chain.back()], pts[i]) < 0)
+                chain.pop_back();
+            chain.push_back(i);
+        }
+        for (int i : chain) on[i] = 1;
+    }
+    for (int i = 0; i < n; ++i) (on[i] ? boundary : inner).push_back(pts[i]);
+}
+
+// Слои с добавлением и удалением точек. Для каждого слоя хранится не только
+// строгая оболочка, но и все точки, снимаемые вместе с ним (коллинеарные на
+// рёбрах). Добавленная точка попадает в первый слой, оболочка которого её не
+// содержит; вытесненные из слоя точки спускаются в следующий, пока слой не
+// перестанет меняться. При удалении точки слоя в него поднимаются точки
+// следующего слоя, оказавшиеся на новой границе, и так далее. Слои выше
+// места изменения не трогаются, каждый затронутый слой пересчитывается за
+// O(m log m) от своего размера. Повторяющиеся точки не хранятся.
+class DynamicLayers {
+public:
+    DynamicLayers() = default;
+    explicit DynamicLayers(const std::vector<Point>& src) {
+        std::vector<Point> pts = src;
+        sort_xy(pts);
+        pts.erase(std::unique(pts.begin(), pts.end(), same), pts.end());
+        // оболочки слоёв — из build_layers, точки раскладываются по слоям
+        // поиском по вложенным оболочкам, и каждый слой снимается один раз
+        // по своим точкам, чтобы получить его полный состав
+        auto hulls = build_layers(pts);
+        layers_.resize(hulls.size());
+        for (std::size_t k = 0; k < hulls.size(); ++k) layers_[k].hull = std::move(hulls[k]);
+        std::vector<std::vector<Point>> own(layers_.size());
+        for (const auto& p : pts) own[covering(p) - 1].push_back(p);
+        std::vector<Point> hull, inner;
+        for (std::size_t k = 0; k < own.size(); ++k)
+            peel_once(own[k], hull, layers_[k].members, inner);
+    }
+
+    int size() const { return static_cast<int>(layers_.size()); }
+    const std::vector<Point>& layer(int k) const { return layers_[k].hull; }
+
+    int depth(const Point& q) const {
+        int c = covering(q);
+        return c ? c - 1 : 0;
+    }
+
+    bool insert(const Point& p) {
+        int c = covering(p);
+        if (c > 0) {
+            Layer& l = layers_[c - 1];
+            auto it = std::lower_bound(l.members.begin(), l.members.end(), p, cmp_xy);
+            if (it != l.members.end() && same(*it, p)) return false;
+            if (on_boundary(l.hull, p)) {
+                l.members.insert(it, p);
+                return true;
+            }
+        }
+        push_down(c, {p});
+        return true;
+    }
+
+    bool erase(const Point& p) {
+        int c = covering(p);
+        if (!c) return false;
+        int j = c - 1;
+        auto& m = layers_[j].members;
+        auto it = std::lower_bound(m.begin(), m.end(), p, cmp_xy);
+        if (it == m.end() || !same(*it, p)) return false;
+        m.erase(it);
+        pull_up(j);
+        return true;
+    }
+
+private:
+    struct Layer {
+        std::vector<Point> hull, members;
+    };
+
+    static bool on_boundary(const std::vector<Point>& h, const Point& p) {
+        int m = static_cast<int>(h.size());
+        if (m == 1) return same(h[0], p);
+        for (int i = 0; i < m; ++i)
+            if (on_segment(h[i], h[(i + 1) % m], p)) return true;
+        return false;
+    }
+
+    // число слоёв, замкнутая оболочка которых содержит q
+    int covering(const Point& q) const {
+        int lo = 0, hi = size();
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (inside_convex(layers_[mid].hull, q))
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    static std::vector<Point> merged(const std::vector<Point>& a,
+                                     const std::vector<Point>& b) {
+        std::vector<Point> out;
+        out.reserve(a.size() + b.size());
+        std::merge(a.begin(), a.end(), b.begin(), b.end(),
+                   std::back_inserter(out), cmp_xy);
+        return out;
+    }
+
+    // точки d лежат вне слоя k (или на его месте слоя нет) и входят в него
+    void push_down(int k, std::vector<Point> d) {
+        std::vector<Point> hull, boundary, inner;
+        for (; !d.empty(); ++k) {
+            if (k == size()) layers_.emplace_back();
+            peel_once(merged(layers_[k].members, d), hull, boundary, inner);
+            layers_[k].hull.swap(hull);
+            layers_[k].members.swap(boundary);
+            d.swap(inner);
+        }
+    }
+
+    // слой j потерял точки: поднимаем в него новые граничные точки снизу
+    void pull_up(int j) {
+        std::vector<Point> hull, boundary, inner;
+        for (; j < size(); ++j) {
+            auto& cur = layers_[j];
+            if (j + 1 == size()) {
+                if (cur.members.empty()) {
+                    layers_.pop_back();
+                } else {
+                    peel_once(cur.members, hull, boundary, inner);
+                    cur.hull.swap(hull);
+                }
+                return;
+            }
+            auto& next = layers_[j + 1];
+            std::size_t before = cur.members.size();
+            peel_once(merged(cur.members, next.members), hull, boundary, inner);
+            cur.hull.swap(hull);
+            cur.members.swap(boundary);
+            if (cur.members.size() == before) return;
+            next.members.swap(inner);
+            if (next.members.empty()) {
+                layers_.erase(layers_.begin() + j + 1);
+                return;
+            }
+        }
+    }
+
+    std::vector<Layer> layers_;
+};
+
+inline std::uint64_t hilbert_key(std::uint32_t x, std::uint32_t y, int order) {
+    std::uint64_t d = 0;
+    for (std::uint32_t s = 1u << (order - 1); s; s >>= 1) {
+        std::uint32_t rx = (x & s) ? 1 : 0;
+        std::uint32_t ry = (y & s) ? 1 : 0;
+        d += static_cast<std::uint64_t>(s) * s * ((3 * rx) ^ ry);
+        if (!ry) {
+            if (rx) {
+                x = s - 1 - (x & (s - 1));
+                y = s - 1 - (y & (s - 1));
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+// Пакетный режим: запросы сортируются вдоль кривой Гильберта, чтобы
+// соседние запросы шли по тем же слоям и каталогам, раздаются потокам
+// кусками по мере готовности и раскладываются обратно по исходным местам.
+inline std::vector<int> answer_batch(const LayerIndex& index,
+                              const std::vector<Point>& queries, int threads) {
+    int k = static_cast<int>(queries.size());
+    std::vector<int> answers(k);
+    if (!k) return answers;
+
+    std::int64_t x0 = queries[0].x, x1 = x0, y0 = queries[0].y, y1 = y0;
+    for (const auto& q : queries) {
+        x0 = std::min(x0, q.x); x1 = std::max(x1, q.x);
+        y0 = std::min(y0, q.y); y1 = std::max(y1, q.y);
+    }
+    const int order = 16;
+    auto scale = [&](std::int64_t v, std::int64_t lo, std::int64_t hi) {
+        if (hi == lo) return 0u;
+        long double t = static_cast<long double>(v - lo) / (hi - lo);
+        return static_cast<std::uint32_t>(t * ((1u << order) - 1));
+    };
+    std::vector<std::pair<std::uint64_t, int>> order_idx(k);
+    for (int i = 0; i < k; ++i)
+        order_idx[i] = {hilbert_key(scale(queries[i].x, x0, x1),
+                                    scale(queries[i].y, y0, y1), order), i};
+    std::sort(order_idx.begin(), order_idx.end());
+
+    par::for_chunks(k, 1 << 12, threads, [&](int lo, int hi) {
+        for (int t = lo; t < hi; ++t) {
+            int i = order_idx[t].second;
+            answers[i] = index.depth(queries[i]);
+        }
+    });
+    return answers;
+}
+
+inline void write_answers(fastio::Writer& out, const std::vector<int>& answers) {
+    for (int a : answers) {
+        out.write(a);
+        out.put('\n');
+    }
+}
+
+inline std::vector<Point> read_points(fastio::Reader& in) {
+    std::vector<Point> pts(in.next<int>());
+    for (auto& p : pts) {
+        in.read(p.x);
+        in.read(p.y);
+    }
+    return pts;
+}
+
+inline void run_task(fastio::Reader& in, fastio::Writer& out,
+                     int threads = static_cast<int>(std::thread::hardware_concurrency())) {
+    std::vector<Point> attractions, queries;
+    {
+        ALGOS_PHASE("onion.parse");
+        attractions = read_points(in);
+        queries = read_points(in);
+    }
+    const LayerIndex index = [&] {
+        ALGOS_PHASE("onion.build");
+        return LayerIndex(build_layers(attractions, threads));
+    }();
+    std::vector<int> answers;
+    {
+        ALGOS_PHASE("onion.query");
+        answers = answer_batch(index, queries, threads);
+    }
+    ALGOS_COUNT("onion.depth_queries", answers.size());
+    ALGOS_PHASE("onion.output");
+    write_answers(out, answers);
+}
+
+}  // namespace onion
@@ -0,0 +1,194 @@
+// fast_io.h
+// Shared stdin/stdout layer for the task drivers: the whole input is mapped
+// (or read) at once and parsed with std::from_chars, output is collected in
+// one buffer and formatted with std::to_chars. Fixed-precision output is
+// byte-identical to iostream's std::fixed << std::setprecision(p).
+// Both ends can also work on memory, which is how the batch server feeds
+// request bodies through the same task code.
+
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fastio {
+
+class Reader {
+public:
+    explicit Reader(int fd = 0) {
+        struct stat st {};
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                map_ = p;
+                map_size_ = static_cast<std::size_t>(st.st_size);
+                begin_ = static_cast<const char*>(p);
+                end_ = begin_ + map_size_;
+                cur_ = begin_;
+                return;
+            }
+        }
+        std::size_t used = 0;
+        buf_.resize(1 << 16);
+        for (;;) {
+            if (used == buf_.size()) buf_.resize(buf_.size() * 2);
+            ssize_t got = ::read(fd, buf_.data() + used, buf_.size() - used);
+            if (got <= 0) break;
+            used += static_cast<std::size_t>(got);
+        }
+        begin_ = buf_.data();
+        end_ = begin_ + used;
+        cur_ = begin_;
+    }
+
+    /// @brief Parse from memory; the buffer must outlive the reader.
+    explicit Reader(std::string_view data)
+        : begin_(data.data()), end_(data.data() + data.size()), cur_(data.data()) {}
+
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+
+    ~Reader() {
+        if (map_) munmap(map_, map_size_);
+    }
+
+    /// @brief Parse the next whitespace-separated integer or floating value.
+    template <class T>
+    bool read(T& value) {
+        static_assert(std::is_arithmetic_v<T>, "fastio::Reader::read expects a number");
+        skip_space();
+        if (cur_ == end_) return false;
+        if (*cur_ == '+') ++cur_;
+        std::from_chars_result res;
+        if constexpr (std::is_floating_point_v<T>)
+            res = std::from_chars(cur_, end_, value, std::chars_format::general);
+        else
+            res = std::from_chars(cur_, end_, value);
+        if (res.ec != std::errc()) return false;
+        cur_ = res.ptr;
+        return true;
+    }
+
+    template <class T>
+    T next() {
+        T value{};
+        read(value);
+        return value;
+    }
+
+    /// @brief Same contract as std::getline: up to '\n', which is consumed.
+    bool line(std::string& out) {
+        if (cur_ == end_) {
+            out.clear();
+            return false;
+        }
+        const char* nl = static_cast<const char*>(std::memchr(cur_, '\n', end_ - cur_));
+        const char* stop = nl ? nl : end_;
+        out.assign(cur_, stop);
+        cur_ = nl ? nl + 1 : end_;
+        return true;
+    }
+
+private:
+    void skip_space() {
+        while (cur_ != end_ && static_cast<unsigned char>(*cur_) <= ' ') ++cur_;
+    }
+
+    std::vector<char> buf_;
+    void* map_ = nullptr;
+    std::size_t map_size_ = 0;
+    const char* begin_ = nullptr;
+    const char* end_ = nullptr;
+    const char* cur_ = nullptr;
+};
+
+class Writer {
+public:
+    explicit Writer(int fd = 1) : fd_(fd) { buf_.resize(kSize); }
+
+    /// @brief Append everything to sink instead of a file descriptor.
+    explicit Writer(std::string& sink) : sink_(&sink) { buf_.resize(kSize); }
+
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    ~Writer() { flush(); }
+
+    void put(char c) {
+        reserve(1);
+        buf_[len_++] = c;
+    }
+
+    void write(std::string_view s) {
+        if (s.size() > kSize) {
+            flush();
+            raw(s.data(), s.size());
+            return;
+        }
+        reserve(s.size());
+        std::memcpy(buf_.data() + len_, s.data(), s.size());
+        len_ += s.size();
+    }
+
+    template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+    void write(T value) {
+        reserve(24);
+        len_ = std::to_chars(buf_.data() + len_, buf_.data() + buf_.size(), value).ptr -
+               buf_.data();
+    }
+
+    /// @brief Equivalent of std::fixed << std::setprecision(precision) << value.
+    void write_fixed(double value, int precision) {
+        for (std::size_t need = 64;; need *= 2) {
+            reserve(need);
+            auto res = std::to_chars(buf_.data() + len_, buf_.data() + buf_.size(), value,
+                                     std::chars_format::fixed, precision);
+            if (res.ec == std::errc()) {
+                len_ = res.ptr - buf_.data();
+                return;
+            }
+        }
+    }
+
+    void flush() {
+        raw(buf_.data(), len_);
+        len_ = 0;
+    }
+
+private:
+    static constexpr std::size_t kSize = 1 << 16;
+
+    void reserve(std::size_t n) {
+        if (len_ + n > buf_.size()) flush();
+        if (n > buf_.size()) buf_.resize(n);
+    }
+
+    void raw(const char* p, std::size_t n) {
+        if (sink_) {
+            sink_->append(p, n);
+            return;
+        }
+        while (n) {
+            ssize_t put = ::write(fd_, p, n);
+            if (put <= 0) return;
+            p += put;
+            n -= static_cast<std::size_t>(put);
+        }
+    }
+
+    int fd_ = -1;
+    std::string* sink_ = nullptr;
+    std::vector<char> buf_;
+    std::size_t len_ = 0;
+};
+
+}  // namespace fastio
@@ -0,0 +1,183 @@
+// instrument.h
+// Optional hot-path instrumentation: named counters and phase timers.
+// Everything is compiled in only when ALGOS_INSTRUMENT is defined (CMake
+// option ALGOS_INSTRUMENT); otherwise the macros expand to nothing and the
+// counted expressions are not even evaluated.
+//
+//   ALGOS_COUNT("hull.visible_faces", visible.size());
+//   { ALGOS_PHASE("hull.build"); planes = BuildConvexHull(points); }
+//
+// Counters and timers are process-wide and safe to bump from worker threads;
+// hot loops should count into a local and add once. The totals are written
+// as JSON at exit (to the file named by $ALGOS_STATS, stderr by default) and
+// whenever instr::dump_json is called.
+
+#pragma once
+
+#include "fast_io.h"
+
+#ifdef ALGOS_INSTRUMENT
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace instr {
+
+struct Counter {
+    explicit Counter(const char* n) : name(n) {}
+    const char* name;
+    std::atomic<std::uint64_t> value{0};
+};
+
+struct Timer {
+    explicit Timer(const char* n) : name(n) {}
+    const char* name;
+    std::atomic<std::uint64_t> ns{0};
+    std::atomic<std::uint64_t> calls{0};
+};
+
+class Registry {
+public:
+    Registry() = default;
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    ~Registry() {
+        const char* path = std::getenv("ALGOS_STATS");
+        int fd = path && *path ? ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644) : 2;
+        if (fd < 0) return;
+        {
+            fastio::Writer out(fd);
+            dump(out);
+        }
+        if (fd != 2) ::close(fd);
+    }
+
+    Counter& counter(const char* name) { return find(counters_, name); }
+    Timer& timer(const char* name) { return find(timers_, name); }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& c : counters_) c.value = 0;
+        for (auto& t : timers_) t.ns = t.calls = 0;
+    }
+
+    void dump(fastio::Writer& out) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        out.write("{\"enabled\": true, \"phases\": {");
+        const char* sep = "\n  ";
+        for (const Timer* t : sorted(timers_)) {
+            out.write(sep);
+            out.put('"');
+            out.write(t->name);
+            out.write("\": {\"calls\": ");
+            out.write(t->calls.load());
+            out.write(", \"seconds\": ");
+            out.write_fixed(static_cast<double>(t->ns.load()) * 1e-9, 9);
+            out.put('}');
+            sep = ",\n  ";
+        }
+        out.write("}, \"counters\": {");
+        sep = "\n  ";
+        for (const Counter* c : sorted(counters_)) {
+            out.write(sep);
+            out.put('"');
+            out.write(c->name);
+            out.write("\": ");
+            out.write(c->value.load());
+            sep = ",\n  ";
+        }
+        out.write("}}\n");
+    }
+
+private:
+    template <class T>
+    T& find(std::deque<T>& items, const char* name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& item : items)
+            if (std::strcmp(item.name, name) == 0) return item;
+        return items.emplace_back(name);
+    }
+
+    template <class T>
+    static std::vector<const T*> sorted(const std::deque<T>& items) {
+        std::vector<const T*> v;
+        for (const auto& item : items) v.push_back(&item);
+        std::sort(v.begin(), v.end(),
+                  [](const T* a, const T* b) { return std::strcmp(a->name, b->name) < 0; });
+        return v;
+    }
+
+    std::mutex mutex_;
+    std::deque<Counter> counters_;
+    std::deque<Timer> timers_;
+};
+
+inline Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+inline Counter& counter(const char* name) { return registry().counter(name); }
+inline Timer& timer(const char* name) { return registry().timer(name); }
+
+/// @brief Adds the wall time of its scope to a timer.
+class Phase {
+public:
+    explicit Phase(Timer& t) : t_(t), start_(std::chrono::steady_clock::now()) {}
+    Phase(const Phase&) = delete;
+    Phase& operator=(const Phase&) = delete;
+    ~Phase() {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start_).count();
+        t_.ns.fetch_add(static_cast<std::uint64_t>(ns), std::memory_order_relaxed);
+        t_.calls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    Timer& t_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+inline void dump_json(fastio::Writer& out) { registry().dump(out); }
+inline void reset() { registry().reset(); }
+
+}  // namespace instr
+
+#define ALGOS_CAT_(a, b) a##b
+#define ALGOS_CAT(a, b) ALGOS_CAT_(a, b)
+
+#define ALGOS_COUNT(name, n)                                                   \
+    do {                                                                       \
+        static ::instr::Counter& algos_counter_ = ::instr::counter(name);     \
+        algos_counter_.value.fetch_add(static_cast<std::uint64_t>(n),          \
+                                       std::memory_order_relaxed);             \
+    } while (0)
+
+#define ALGOS_PHASE(name)                                                      \
+    static ::instr::Timer& ALGOS_CAT(algos_timer_, __LINE__) = ::instr::timer(name); \
+    ::instr::Phase ALGOS_CAT(algos_phase_, __LINE__)(ALGOS_CAT(algos_timer_, __LINE__))
+
+#else
+
+namespace instr {
+
+inline void dump_json(fastio::Writer& out) { out.write("{\"enabled\": false}\n"); }
+inline void reset() {}
+
+}  // namespace instr
+
+#define ALGOS_COUNT(name, n) static_cast<void>(sizeof(n))
+#define ALGOS_PHASE(name) static_cast<void>(0)
+
+#endif
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "fast_io.h"
+#include "instrument.h"
+
+namespace minkowski {
+
+struct Point {
+    long double x, y;
+};
+
+using Polygon = std::vector<Point>;
+
+inline long double cross(const Point& a, const Point& b) {
+    return a.x * b.y - a.y * b.x;
+}
+inline Point operator+(const Point& a, const Point& b) {
+    return { a.x + b.x, a.y + b.y };
+}
+inline Point operator-(const Point& a, const Point& b) {
+    return { a.x - b.x, a.y - b.y };
+}
+
+struct Data {
+    Polygon airport;
+    Polygon cloud;
+};
+
+inline Data read_input(fastio::Reader& in) {
+
+    int n = in.next<int>(), m = in.next<int>();
+    Polygon A(n), B(m);
+    for (auto& p : A) { in.read(p.x); in.read(p.y); }
+    for (auto& p : B) { in.read(p.x); in.read(p.y); }
+    return { std::move(A), std::move(B) };
+}
+
+inline void write_output(fastio::Writer& out, long double sec) {
+    out.write_fixed(static_cast<double>(sec), 10);
+}
+
+inline int lex_lowest(const Polygon& P) {
+    int idx = 0;
+    for (int i = 1; i < (int)P.size(); ++i)
+        if (P[i].y < P[idx].y || (P[i].y == P[idx].y && P[i].x < P[idx].x))
+            idx = i;
+    return idx;
+}
+
+inline Polygon minkowski_sum(const Polygon& A, const Polygon& B) {
+    int n = static_cast<int>(A.size());
+    int m = static_cast<int>(B.size());
+    int ia = lex_lowest(A);
+    int ib = lex_lowest(B);
+
+    Polygon C;
+    C.reserve(n + m);
+
+    int i = 0, j = 0;
+    Point cur = A[ia] + B[ib];
+    C.push_back(cur);
+
+    while (i < n || j < m) {
+        Point va = A[(ia + 1) % n] - A[ia];
+        Point vb = B[(ib + 1) % m] - B[ib];
+
+        long double z = (i == n ? 0 : (j == m ? 0 : cross(va, vb)));
+        if (j == m || (i < n && z > 0)) {
+            ia = (ia + 1) % n;
+            cur = cur + va;
+            ++i;
+        } else if (i == n || z < 0) {
+            ib = (ib + 1) % m;
+            cur = cur + vb;
+            ++j;
+        } else {
+            ia = (ia + 1) % n;
+            ib = (ib + 1) % m;
+            cur = cur + va + vb;
+            ++i; ++j;
+        }
+        C.push_back(cur);
+    }
+    C.pop_back();
+    ALGOS_COUNT("minkowski.sum_vertices", C.size());
+    return C;
+}
+
+inline long double dist_origin_to_edge(const Point& a, const Point& b) {
+    long double area2 = fabsl(cross(a, b));
+    long double len = std::hypotl(b.x - a.x, b.y - a.y);
+    return area2 / len;
+}
+
+inline long double min_distance_to_boundary(const Polygon& P) {
+    long double best = 1e100L;
+    int n = static_cast<int>(P.size());
+    for (int i = 0; i < n; ++i) {
+        const Point& a = P[i];
+        const Point& b = P[(i + 1) % n];
+        best = std::min(best, dist_origin_to_edge(a, b));
+    }
+    return best;
+}
+
+inline long double solve(const Data& d) {
+    Polygon inv_cloud = d.cloud;
+    for (auto& p : inv_cloud) { p.x = -p.x; p.y = -p.y; }
+
+    Polygon mink;
+    {
+        ALGOS_PHASE("minkowski.build");
+        mink = minkowski_sum(d.airport, inv_cloud);
+    }
+
+    ALGOS_PHASE("minkowski.query");
+    long double dist = min_distance_to_boundary(mink);
+    const long double passed = 60.0L;
+    if (dist <= passed + 1e-12L) return 0.0L;
+    return dist - passed;
+}
+
+inline void run_task(fastio::Reader& in, fastio::Writer& out) {
+    Data data;
+    {
+        ALGOS_PHASE("minkowski.parse");
+        data = read_input(in);
+    }
+    long double ans = solve(data);
+    ALGOS_PHASE("minkowski.output");
+    write_output(out, ans);
+}
+
+}  // namespace minkowski
@@ -0,0 +1,38 @@
+// parallel.h
+// Thread helpers shared by the task headers.
+//
+//   par::run(jobs, [&](int j) { ... });               // jobs 0..jobs-1 at once
+//   par::for_chunks(n, chunk, threads, [&](int lo, int hi) { ... });
+//
+// run starts one thread per job except job 0, which runs on the caller, and
+// joins them all. for_chunks splits [0, n) into chunks of the given size and
+// hands them out to at most `threads` workers as they become free, so uneven
+// chunks balance themselves.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace par {
+
+template <class F>
+void run(int jobs, F&& job) {
+    std::vector<std::thread> pool;
+    for (int j = 1; j < jobs; ++j) pool.emplace_back(job, j);
+    job(0);
+    for (auto& th : pool) th.join();
+}
+
+template <class F>
+void for_chunks(int n, int chunk, int threads, F&& body) {
+    threads = std::max(1, std::min(threads, (n + chunk - 1) / chunk));
+    std::atomic<int> next{0};
+    run(threads, [&](int) {
+        for (int lo; (lo = next.fetch_add(chunk)) < n;) body(lo, std::min(n, lo + chunk));
+    });
+}
+
+}  // namespace par
@@ -0,0 +1,243 @@
+// server.cpp
+// Long-running batch front end for the task libraries. Requests and replies
+// are frames: a little-endian uint32 payload length followed by the payload.
+//
+// A request payload is a command line terminated by '\n' and a body in the
+// same text format the corresponding driver reads on stdin:
+//
+//   K | I | D | F | G | H      run the task on the body, reply with its output
+//   hull.build NAME            build a 3D hull from "n x y z ..." and keep it
+//   hull.query NAME            distances from "k x y z ..." to a kept hull
+//   layers.build NAME          peel convex layers of "n x y ..." and keep them
+//   layers.query NAME          depths of "k x y ..." in kept layers
+//   hull2d                     strict convex hull of "n x y ...": vertex count,
+//                              then the vertices counter-clockwise
+//   drop NAME                  forget any structure kept under NAME
+//   stats                      instrumentation totals as JSON (instrument.h)
+//   stats.reset                zero all counters and phase timers
+//
+// The reply payload starts with "OK\n" followed by the output, or is a single
+// "ERR <reason>\n" line. Frames come from stdin (replies go to stdout), or,
+// with --socket PATH, from every client of a Unix socket in turn; the cache
+// is shared between clients.
+
+#include <algorithm>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "convex_layers.h"
+#include "fast_io.h"
+#include "hull3d.h"
+#include "instrument.h"
+#include "minkowski.h"
+#include "pattern_matching.h"
+#include "polynomial_inverse.h"
+#include "voronoi.h"
+
+namespace {
+
+bool read_exact(int fd, char* p, std::size_t n) {
+    while (n) {
+        ssize_t got = ::read(fd, p, n);
+        if (got <= 0) return false;
+        p += got;
+        n -= static_cast<std::size_t>(got);
+    }
+    return true;
+}
+
+bool write_exact(int fd, const char* p, std::size_t n) {
+    while (n) {
+        ssize_t put = ::write(fd, p, n);
+        if (put <= 0) return false;
+        p += put;
+        n -= static_cast<std::size_t>(put);
+    }
+    return true;
+}
+
+bool read_frame(int fd, std::string& payload) {
+    unsigned char len[4];
+    if (!read_exact(fd, reinterpret_cast<char*>(len), 4)) return false;
+    std::uint32_t n = len[0] | len[1] << 8 | len[2] << 16 | std::uint32_t{len[3]} << 24;
+    payload.resize(n);
+    return read_exact(fd, payload.data(), n);
+}
+
+bool write_frame(int fd, std::string_view payload) {
+    std::uint32_t n = static_cast<std::uint32_t>(payload.size());
+    unsigned char len[4] = {static_cast<unsigned char>(n), static_cast<unsigned char>(n >> 8),
+                            static_cast<unsigned char>(n >> 16),
+                            static_cast<unsigned char>(n >> 24)};
+    return write_exact(fd, reinterpret_cast<const char*>(len), 4) &&
+           write_exact(fd, payload.data(), payload.size());
+}
+
+class Server {
+public:
+    Server() : threads_(std::max(1u, std::thread::hardware_concurrency())) {}
+
+    /// @brief Answer one request payload; never throws.
+    std::string handle(std::string_view payload) {
+        std::size_t nl = payload.find('\n');
+        std::string_view head = payload.substr(0, nl);
+        std::string_view body = nl == std::string_view::npos ? std::string_view{}
+                                                             : payload.substr(nl + 1);
+        std::size_t sp = head.find(' ');
+        std::string_view command = head.substr(0, sp);
+        std::string name(sp == std::string_view::npos ? std::string_view{} : head.substr(sp + 1));
+
+        std::string reply = "OK\n";
+        try {
+            fastio::Reader in(body);
+            fastio::Writer out(reply);
+            dispatch(command, name, in, out);
+        } catch (const std::exception& e) {
+            return "ERR " + std::string(e.what()) + "\n";
+        }
+        return reply;
+    }
+
+private:
+    void dispatch(std::string_view command, const std::string& name, fastio::Reader& in,
+                  fastio::Writer& out) {
+        if (command == "K") return wildcard::runTask(in, out);
+        if (command == "I") return poly::RunTask(in, out);
+        if (command == "D") {
+            auto data = minkowski::read_input(in);
+            if (data.airport.empty() || data.cloud.empty())
+                throw std::runtime_error("need n, m >= 1");
+            return minkowski::write_output(out, minkowski::solve(data));
+        }
+        if (command == "F") {
+            auto data = hull::ReadInput(in);
+            if (data.points.size() < 4) throw std::runtime_error("need at least 4 points");
+            auto planes = hull::BuildConvexHull(data.points);
+            return hull::WriteOutput(out, hull::AnswerQueries(planes, data.queries));
+        }
+        if (command == "G") return voronoi::run_task(in, out, threads_);
+        if (command == "H") return onion::run_task(in, out, threads_);
+
+        if (command == "hull2d") {
+            auto hull = onion::fast_hull(onion::read_points(in), threads_);
+            out.write(hull.size());
+            out.put('\n');
+            for (const auto& p : hull) {
+                out.write(p.x);
+                out.put(' ');
+                out.write(p.y);
+                out.put('\n');
+            }
+            return;
+        }
+        if (command == "stats") return instr::dump_json(out);
+        if (command == "stats.reset") return instr::reset();
+
+        if (command == "drop") {
+            std::size_t dropped = hulls_.erase(name) + layers_.erase(name);
+            if (!dropped)
+                throw std::runtime_error("nothing cached as '" + name + "'");
+            return;
+        }
+
+        if (command != "hull.build" && command != "hull.query" && command != "layers.build" &&
+            command != "layers.query")
+            throw std::runtime_error("unknown command '" + std::string(command) + "'");
+        if (name.empty()) throw std::runtime_error("missing structure name");
+        if (command == "hull.build") {
+            hull::InputData data;
+            data.points.resize(in.next<std::size_t>());
+            for (auto& p : data.points) read_vector(in, p);
+            if (data.points.size() < 4) throw std::runtime_error("need at least 4 points");
+            hulls_[name] = hull::BuildConvexHull(data.points);
+            return;
+        }
+        if (command == "hull.query") {
+            auto it = hulls_.find(name);
+            if (it == hulls_.end()) throw std::runtime_error("no hull '" + name + "'");
+            std::vector<math3d::Vector3> queries(in.next<std::size_t>());
+            for (auto& q : queries) read_vector(in, q);
+            return hull::WriteOutput(out, hull::AnswerQueries(it->second, queries));
+        }
+        if (command == "layers.build") {
+            auto layers = onion::build_layers(onion::read_points(in), threads_);
+            layers_[name] = std::make_unique<onion::LayerIndex>(layers);
+            return;
+        }
+        auto it = layers_.find(name);
+        if (it == layers_.end()) throw std::runtime_error("no layers '" + name + "'");
+        auto queries = onion::read_points(in);
+        return onion::write_answers(out, onion::answer_batch(*it->second, queries, threads_));
+    }
+
+    static void read_vector(fastio::Reader& in, math3d::Vector3& v) {
+        in.read(v.x);
+        in.read(v.y);
+        in.read(v.z);
+    }
+
+    int threads_;
+    std::unordered_map<std::string, std::vector<hull::Plane>> hulls_;
+    std::unordered_map<std::string, std::unique_ptr<onion::LayerIndex>> layers_;
+};
+
+void serve(Server& server, int in_fd, int out_fd) {
+    std::string payload;
+    while (read_frame(in_fd, payload))
+        if (!write_frame(out_fd, server.handle(payload))) return;
+}
+
+int listen_unix(const char* path) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (std::strlen(path) >= sizeof(addr.sun_path)) return -1;
+    std::strcpy(addr.sun_path, path);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    ::unlink(path);
+    if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || listen(fd, 16) < 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Server server;
+    if (argc == 3 && std::string_view(argv[1]) == "--socket") {
+        std::signal(SIGPIPE, SIG_IGN);
+        int fd = listen_unix(argv[2]);
+        if (fd < 0) {
+            std::perror("server: socket");
+            return 1;
+        }
+        for (;;) {
+            int client = accept(fd, nullptr, nullptr);
+            if (client < 0) continue;
+            serve(server, client, client);
+            ::close(client);
+        }
+    }
+    if (argc != 1) {
+        std::fputs("usage: server [--socket PATH]\n", stderr);
+        return 2;
+    }
+    serve(server, 0, 1);
+    return 0;
+}
@@ -0,0 +1,643 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <thread>
+
+#include "fast_io.h"
+#include "instrument.h"
+#include "parallel.h"
+
+namespace voronoi {
+
+struct Point { double x, y; };
+
+constexpr double EPS = 1e-9;
+
+/* значение линейной функции на точке */
+inline double val(const Point& p, double a, double b, double c)
+{ return a * p.x + b * p.y + c; }
+
+/* пересечение отрезка [p,q] с прямой a·x + b·y + c = 0 */
+inline Point intersect(const Point& p, const Point& q,
+                double a, double b, double c)
+{
+    double t = -val(p, a, b, c) /
+               (a * (q.x - p.x) + b * (q.y - p.y));
+    return {p.x + t * (q.x - p.x), p.y + t * (q.y - p.y)};
+}
+
+/* клипуем выпуклый многоугольник полуплоскостью a·x+b·y+c≤0, результат в res */
+inline void clip(const std::vector<Point>& poly,
+          double a, double b, double c, std::vector<Point>& res)
+{
+    res.clear();
+    int m = static_cast<int>(poly.size());
+    if (!m) return;
+    for (int i = 0; i < m; ++i) {
+        const Point& cur = poly[i];
+        const Point& nxt = poly[(i + 1) % m];
+        bool in_cur = val(cur, a, b, c) <= EPS;
+        bool in_nxt = val(nxt, a, b, c) <= EPS;
+
+        if (in_cur && in_nxt) {
+            res.push_back(nxt);
+        } else if (in_cur && !in_nxt) {
+            res.push_back(intersect(cur, nxt, a, b, c));
+        } else if (!in_cur && in_nxt) {
+            res.push_back(intersect(cur, nxt, a, b, c));
+            res.push_back(nxt);
+        }
+    }
+}
+
+/* убираем дубли и коллинеарные вершины; t — рабочий буфер */
+inline void tidy(std::vector<Point>& v, std::vector<Point>& t)
+{
+    const double LIM = 1e-8;
+    auto dist2 = [](const Point& p, const Point& q)
+    { double dx = p.x - q.x, dy = p.y - q.y; return dx*dx + dy*dy; };
+
+    t.clear();
+    for (auto& p: v)
+        if (t.empty() || dist2(p, t.back()) > LIM) t.push_back(p);
+    if (t.size() > 1 && dist2(t.front(), t.back()) < LIM) t.pop_back();
+    v.swap(t);
+
+    t.clear();
+    int m = static_cast<int>(v.size());
+    for (int i = 0; i < m; ++i) {
+        Point a = v[(i + m - 1) % m], b = v[i], c = v[(i + 1) % m];
+        double cr = (b.x - a.x)*(c.y - b.y) - (b.y - a.y)*(c.x - b.x);
+        if (std::fabs(cr) > 1e-10) t.push_back(b);
+    }
+    v.swap(t);
+}
+
+/* начинаем обход с самой нижней среди самых левых вершин */
+inline void rotate_start(std::vector<Point>& poly)
+{
+    if (poly.empty()) return;
+    int best = 0;
+    for (int i = 1; i < (int)poly.size(); ++i) {
+        if (poly[i].x < poly[best].x - EPS ||
+           (std::fabs(poly[i].x - poly[best].x) < EPS &&
+            poly[i].y < poly[best].y - EPS))
+            best = i;
+    }
+    std::rotate(poly.begin(), poly.begin() + best, poly.end());
+}
+
+/* квадрат максимального расстояния от сайта до вершин ячейки */
+inline double radius2(const std::vector<Point>& poly, const Point& s)
+{
+    double r = 0;
+    for (auto& v : poly) {
+        double dx = v.x - s.x, dy = v.y - s.y;
+        r = std::max(r, dx*dx + dy*dy);
+    }
+    return r;
+}
+
+/* буферы одного потока: переиспользуются от ячейки к ячейке */
+struct Worker {
+    std::vector<Point> poly, buf;
+    std::vector<std::pair<double, int>> near;
+
+    Worker() { poly.reserve(64); buf.reserve(64); }
+};
+
+/*
+ * Неявное kd-дерево над сайтами: узел — отрезок [lo,hi) массивов pt/id
+ * (точки в порядке дерева и их номера), сайт узла — pt[mid],
+ * mid = (lo+hi)/2, оси чередуются. Для узла хранится прямоугольник,
+ * ограничивающий его сайты (по индексу mid). Узлы не больше kLeaf
+ * просматриваются подряд.
+ */
+class KdTree {
+public:
+    explicit KdTree(const std::vector<Point>& p)
+        : pt_(p), id_(p.size()), box_(p.size())
+    {
+        for (int i = 0; i < static_cast<int>(id_.size()); ++i) id_[i] = i;
+        build(0, static_cast<int>(id_.size()), 0);
+    }
+
+    /* номера сайтов в порядке дерева: соседние в нём сайты близки */
+    const std::vector<int>& order() const { return id_; }
+
+    /* ближайший к q сайт, при равных расстояниях — с меньшим номером */
+    int nearest(const Point& q) const
+    {
+        int best = -1;
+        double best_d2 = 0;
+        nearest(0, static_cast<int>(id_.size()), 0, q, -1, best, best_d2);
+        return best;
+    }
+
+    /*
+     * Сайты j ≠ skip в порядке (расстояние до q, номер), пока расстояние не
+     * больше lim2: f(j, d2). Вызывающий может уменьшать lim2 по ходу. Сайты
+     * собираются кругами: первый радиус — два расстояния до ближайшего
+     * соседа, каждый следующий вдвое больше, и в очередной круг попадают
+     * только сайты вне предыдущего. Так число перебранных сайтов следует
+     * за локальной плотностью, а не за средней. Кроме того, сайт может
+     * отрезать вершину v ячейки w.poly, только если он ближе к v, чем q,
+     * поэтому узлы, не задевающие ни одного круга с центром в вершине
+     * через q, пропускаются: у ячеек на краю скопления, вытянутых в пустоту,
+     * круг радиуса 2R накрывает всё скопление, а эти круги — нет. Первый
+     * аргумент — для совместимости с DynamicGrid: точки дерево хранит само.
+     */
+    template <class F>
+    void by_distance(const std::vector<Point>&, const Point& q, int skip,
+                     const double& lim2, Worker& w, F&& f) const
+    {
+        int n = static_cast<int>(id_.size());
+        int best = -1;
+        double r2 = 0, done = -1;
+        nearest(0, n, 0, q, skip, best, r2);
+        if (best < 0) return;
+        r2 = std::max(4 * r2, EPS);
+        while (done < lim2) {
+            double upto = std::min(r2, lim2);
+            w.near.clear();
+            collect(0, n, q, skip, done, upto, w, w.near);
+            std::sort(w.near.begin(), w.near.end());
+            for (auto& [d2, j] : w.near) {
+                if (d2 > lim2) return;
+                f(j, d2);
+            }
+            done = upto;
+            r2 *= 4;
+        }
+    }
+
+private:
+    struct Box { double x0, y0, x1, y1; };
+
+    static constexpr int kLeaf = 8;
+
+    static double coord(const Point& q, int axis) { return axis ? q.y : q.x; }
+
+    static double dist2(const Point& a, const Point& b)
+    {
+        double dx = a.x - b.x, dy = a.y - b.y;
+        return dx*dx + dy*dy;
+    }
+
+    /* квадраты наименьшего и наибольшего расстояний от q до точек b */
+    static double near2(const Box& b, const Point& q)
+    {
+        double dx = std::max(std::max(b.x0 - q.x, q.x - b.x1), 0.0);
+        double dy = std::max(std::max(b.y0 - q.y, q.y - b.y1), 0.0);
+        return dx*dx + dy*dy;
+    }
+    static double far2(const Box& b, const Point& q)
+    {
+        double dx = std::max(q.x - b.x0, b.x1 - q.x);
+        double dy = std::max(q.y - b.y0, b.y1 - q.y);
+        return dx*dx + dy*dy;
+    }
+
+    void build(int lo, int hi, int axis)
+    {
+        if (lo >= hi) return;
+        int mid = (lo + hi) / 2;
+        std::nth_element(id_.begin() + lo, id_.begin() + mid,
+                         id_.begin() + hi, [&](int a, int b) {
+                             return coord(pt_[a], axis) < coord(pt_[b], axis);
+                         });
+        build(lo, mid, axis ^ 1);
+        build(mid + 1, hi, axis ^ 1);
+        if (lo == 0 && hi == static_cast<int>(id_.size())) {
+            std::vector<Point> sorted(id_.size());
+            for (std::size_t k = 0; k < id_.size(); ++k) sorted[k] = pt_[id_[k]];
+            pt_.swap(sorted);
+            bound(lo, hi);
+        }
+    }
+
+    /* прямоугольники узлов; вызывается, когда pt_ уже в порядке дерева */
+    void bound(int lo, int hi)
+    {
+        if (lo >= hi) return;
+        int mid = (lo + hi) / 2;
+        bound(lo, mid);
+        bound(mid + 1, hi);
+        Box b{pt_[mid].x, pt_[mid].y, pt_[mid].x, pt_[mid].y};
+        for (int k : {lo < mid ? (lo + mid) / 2 : -1, mid + 1 < hi ? (mid + 1 + hi) / 2 : -1}) {
+            if (k < 0) continue;
+            b.x0 = std::min(b.x0, box_[k].x0); b.y0 = std::min(b.y0, box_[k].y0);
+            b.x1 = std::max(b.x1, box_[k].x1); b.y1 = std::max(b.y1, box_[k].y1);
+        }
+        box_[mid] = b;
+    }
+
+    /* может ли сайт из b отрезать что-то от w.poly, ячейки сайта q */
+    static bool may_cut(const Box& b, const Point& q, const Worker& w)
+    {
+        for (const auto& v : w.poly)
+            if (near2(b, v) < dist2(v, q) + EPS) return true;
+        return false;
+    }
+
+    /* сайты j ≠ skip с lo2 < d2 ≤ hi2 */
+    void collect(int lo, int hi, const Point& q, int skip, double lo2, double hi2,
+                 const Worker& w, std::vector<std::pair<double, int>>& out) const
+    {
+        if (lo >= hi) return;
+        int mid = (lo + hi) / 2;
+        if (near2(box_[mid], q) > hi2 || far2(box_[mid], q) <= lo2) return;
+        if (!may_cut(box_[mid], q, w)) return;
+        if (hi - lo <= kLeaf) {
+            for (int k = lo; k < hi; ++k) {
+                double d2 = dist2(pt_[k], q);
+                if (d2 > lo2 && d2 <= hi2 && id_[k] != skip) out.push_back({d2, id_[k]});
+            }
+            return;
+        }
+        double d2 = dist2(pt_[mid], q);
+        if (d2 > lo2 && d2 <= hi2 && id_[mid] != skip) out.push_back({d2, id_[mid]});
+        collect(lo, mid, q, skip, lo2, hi2, w, out);
+        collect(mid + 1, hi, q, skip, lo2, hi2, w, out);
+    }
+
+    void nearest(int lo, int hi, int axis, const Point& q, int skip,
+                 int& best, double& best_d2) const
+    {
+        if (lo >= hi) return;
+        int mid = (lo + hi) / 2;
+        int i = id_[mid];
+        double d2 = dist2(pt_[mid], q);
+        if (i != skip && (best < 0 || d2 < best_d2 || (d2 == best_d2 && i < best))) {
+            best = i;
+            best_d2 = d2;
+        }
+        double diff = coord(q, axis) - coord(pt_[mid], axis);
+        int nlo = diff < 0 ? lo : mid + 1, nhi = diff < 0 ? mid : hi;
+        int flo = diff < 0 ? mid + 1 : lo, fhi = diff < 0 ? hi : mid;
+        nearest(nlo, nhi, axis ^ 1, q, skip, best, best_d2);
+        if (best < 0 || diff * diff <= best_d2)
+            nearest(flo, fhi, axis ^ 1, q, skip, best, best_d2);
+    }
+
+    std::vector<Point> pt_;
+    std::vector<int> id_;
+    std::vector<Box> box_;
+};
+
+/*
+ * Ячейку i клипуем соседями в порядке возрастания расстояния, их выдаёт
+ * sites.by_distance (kd-дерево или сетка). Сайт на расстоянии d даёт
+ * серединный перпендикуляр на расстоянии d/2 от p[i], поэтому при d > 2R,
+ * где R — радиус ячейки вокруг p[i], он уже ничего не отрежет: граница
+ * lim2 = 4R² пересчитывается после каждого отсечения и обрывает обход.
+ * Сайт, для которого все вершины ячейки остаются внутри полуплоскости,
+ * пропускается без клипа.
+ */
+template <class S>
+void build_cell(int i, const std::vector<Point>& p, const S& sites,
+                const std::vector<Point>& rect, Worker& w,
+                std::vector<Point>& out)
+{
+    auto& poly = w.poly;
+    poly.assign(rect.begin(), rect.end());
+    double lim2 = 4 * radius2(poly, p[i]) + EPS;
+    long long clips = 0;
+    sites.by_distance(p, p[i], i, lim2, w, [&](int j, double) {
+        double a = 2 * (p[j].x - p[i].x);
+        double b = 2 * (p[j].y - p[i].y);
+        double c = p[i].x*p[i].x + p[i].y*p[i].y
+                 - p[j].x*p[j].x - p[j].y*p[j].y;
+        if (std::none_of(poly.begin(), poly.end(),
+                         [&](const Point& v) { return val(v, a, b, c) > EPS; }))
+            return;
+        clip(poly, a, b, c, w.buf);
+        poly.swap(w.buf);
+        tidy(poly, w.buf);
+        ++clips;
+        lim2 = poly.empty() ? -1 : 4 * radius2(poly, p[i]) + EPS;
+    });
+    rotate_start(poly);
+    out.assign(poly.begin(), poly.end());
+    ALGOS_COUNT("voronoi.cells", 1);
+    ALGOS_COUNT("voronoi.clip_calls", clips);
+    ALGOS_COUNT("voronoi.tidy_calls", clips);
+}
+
+/*
+ * Ячейки независимы, но их стоимость сильно разная (у границы прямоугольника
+ * и на краях скоплений ячейки крупнее), поэтому сайты делятся на равные
+ * диапазоны по потокам, а закончивший свой диапазон поток ворует индексы у
+ * соседей. Сайты берутся в порядке kd-дерева: соседние ячейки обходят одни
+ * и те же узлы, и они остаются в кэше.
+ */
+inline std::vector<std::vector<Point>>
+solve(int X, int Y, const std::vector<Point>& p, int threads = 1)
+{
+    int n = static_cast<int>(p.size());
+    std::vector<std::vector<Point>> cells(n);
+    if (!n) return cells;
+    std::vector<Point> rect = {
+        {0,0}, {static_cast<double>(X),0},
+        {static_cast<double>(X),static_cast<double>(Y)},
+        {0,static_cast<double>(Y)}
+    };
+
+    KdTree g(p);
+    const std::vector<int>& order = g.order();
+    threads = std::max(1, std::min(threads, n));
+    if (threads == 1) {
+        Worker w;
+        for (int i : order) build_cell(i, p, g, rect, w, cells[i]);
+        return cells;
+    }
+
+    std::vector<std::atomic<int>> next(threads);
+    std::vector<int> end(threads);
+    for (int t = 0; t < threads; ++t) {
+        next[t] = static_cast<int>(1LL * n * t / threads);
+        end[t] = static_cast<int>(1LL * n * (t + 1) / threads);
+    }
+    auto run = [&](int t) {
+        Worker w;
+        for (int s = 0; s < threads; ++s) {
+            int v = (t + s) % threads;
+            for (int k; (k = next[v].fetch_add(1)) < end[v];)
+                build_cell(order[k], p, g, rect, w, cells[order[k]]);
+        }
+    };
+    par::run(threads, run);
+    return cells;
+}
+
+/* сетка с изменяемым набором сайтов: ячейка сетки — отдельный вектор */
+struct DynamicGrid {
+    double x0 = 0, y0 = 0, cs = 1;
+    int gx = 1, gy = 1;
+    std::vector<std::vector<int>> bucket;
+
+    /* сетка над прямоугольником [0,X]×[0,Y] примерно на cap сайтов */
+    void reset(int X, int Y, int cap)
+    {
+        double w = std::max<double>(X, 1), h = std::max<double>(Y, 1);
+        cs = std::max(std::sqrt(w * h / std::max(cap, 1)), 1e-6);
+        gx = std::max(1, std::min(static_cast<int>(w / cs) + 1, cap));
+        gy = std::max(1, std::min(static_cast<int>(h / cs) + 1, cap));
+        cs = std::max(w / gx, h / gy) * (1 + 1e-12);
+        bucket.assign(gx * gy, {});
+    }
+
+    int cx(const Point& q) const
+    { return std::min(gx - 1, std::max(0, static_cast<int>((q.x - x0) / cs))); }
+    int cy(const Point& q) const
+    { return std::min(gy - 1, std::max(0, static_cast<int>((q.y - y0) / cs))); }
+    int cell(const Point& q) const { return cy(q) * gx + cx(q); }
+
+    void add(int id, const Point& q) { bucket[cell(q)].push_back(id); }
+    void remove(int id, const Point& q)
+    {
+        auto& b = bucket[cell(q)];
+        b.erase(std::find(b.begin(), b.end(), id));
+    }
+
+    /*
+     * Сайты j ≠ skip по возрастанию расстояния до q, пока оно не больше
+     * lim2, как KdTree::by_distance. Сетка обходится квадратными кольцами
+     * вокруг ячейки q, внутри кольца сайты сортируются; сайты кольца r+1
+     * дальше r·cs, так что обход кончается, как только (r·cs)² > lim2.
+     */
+    template <class F>
+    void by_distance(const std::vector<Point>& p, const Point& q, int skip,
+                     const double& lim2, Worker& w, F&& f) const
+    {
+        int ix = cx(q), iy = cy(q);
+        int max_r = std::max(gx, gy);
+        for (int r = 0; r <= max_r; ++r) {
+            w.near.clear();
+            ring(ix, iy, r, [&](int j) {
+                if (j == skip) return;
+                double dx = p[j].x - q.x, dy = p[j].y - q.y;
+                w.near.push_back({dx*dx + dy*dy, j});
+            });
+            std::sort(w.near.begin(), w.near.end());
+            for (auto& [d2, j] : w.near) {
+                if (d2 > lim2) break;
+                f(j, d2);
+            }
+            double lo = r * cs;
+            if (lo * lo > lim2) break;
+        }
+    }
+
+    /* сайты из квадратного кольца радиуса r (по Чебышёву) вокруг ячейки (ix,iy) */
+    template <class F>
+    void ring(int ix, int iy, int r, F&& f) const
+    {
+        auto visit = [&](int x, int y) {
+            if (x < 0 || y < 0 || x >= gx || y >= gy) return;
+            for (int id : bucket[y * gx + x]) f(id);
+        };
+        if (r == 0) { visit(ix, iy); return; }
+        for (int x = ix - r; x <= ix + r; ++x) {
+            visit(x, iy - r);
+            visit(x, iy + r);
+        }
+        for (int y = iy - r + 1; y <= iy + r - 1; ++y) {
+            visit(ix - r, y);
+            visit(ix + r, y);
+        }
+    }
+};
+
+/*
+ * Разбиение с добавлением и удалением сайтов. Соседи сайта s по диаграмме
+ * лежат не дальше 2R от него (R — радиус ячейки s): на общем ребре есть
+ * точка v с |v-s| = |v-p_j| ≤ R. Поэтому
+ *  - insert строит ячейку s и отрезает от каждой ячейки в круге 2R
+ *    полуплоскость серединного перпендикуляра с s;
+ *  - erase заново строит ячейки в круге 2R вокруг удалённого s.
+ * Сетка перестраивается при изменении числа сайтов вдвое, так что на
+ * равномерных данных обновление стоит O(1) амортизированно плюс число
+ * затронутых ячеек. Номера удалённых сайтов идут в список свободных и
+ * выдаются снова, так что память пропорциональна пику живых сайтов, а не
+ * всей истории вставок.
+ */
+class DynamicVoronoi {
+public:
+    DynamicVoronoi(int X, int Y) : X_(X), Y_(Y)
+    {
+        rect_ = {
+            {0,0}, {static_cast<double>(X),0},
+            {static_cast<double>(X),static_cast<double>(Y)},
+            {0,static_cast<double>(Y)}
+        };
+        g_.reset(X_, Y_, cap_);
+    }
+
+    /* добавляет сайт, возвращает его номер (возможно, номер удалённого) */
+    int insert(const Point& s)
+    {
+        if (++count_ > 2 * cap_) regrid(2 * cap_);
+        int id;
+        if (free_.empty()) {
+            id = static_cast<int>(p_.size());
+            p_.push_back(s);
+            alive_.push_back(true);
+            cells_.emplace_back();
+            pos_.push_back(0);
+        } else {
+            id = free_.back();
+            free_.pop_back();
+            p_[id] = s;
+            alive_[id] = true;
+        }
+        pos_[id] = static_cast<int>(live_.size());
+        live_.push_back(id);
+        g_.add(id, s);
+
+        build_cell(id, p_, g_, rect_, w_, cells_[id]);
+        for_near(id, [&](int j) {
+            double a = 2 * (s.x - p_[j].x);
+            double b = 2 * (s.y - p_[j].y);
+            double c = p_[j].x*p_[j].x + p_[j].y*p_[j].y
+                     - s.x*s.x - s.y*s.y;
+            clip(cells_[j], a, b, c, w_.buf);
+            cells_[j].swap(w_.buf);
+            tidy(cells_[j], w_.buf);
+            rotate_start(cells_[j]);
+            ALGOS_COUNT("voronoi.clip_calls", 1);
+            ALGOS_COUNT("voronoi.tidy_calls", 1);
+        });
+        return id;
+    }
+
+    /* удаляет сайт с номером id */
+    void erase(int id)
+    {
+        if (id < 0 || id >= static_cast<int>(p_.size()) || !alive_[id])
+            return;
+        g_.remove(id, p_[id]);
+        alive_[id] = false;
+        live_[pos_[id]] = live_.back();
+        pos_[live_.back()] = pos_[id];
+        live_.pop_back();
+        free_.push_back(id);
+        --count_;
+        for_near(id, [&](int j) {
+            build_cell(j, p_, g_, rect_, w_, cells_[j]);
+        });
+        cells_[id].clear();
+        if (cap_ > kMinCap && count_ < cap_ / 4) regrid(cap_ / 2);
+    }
+
+    bool alive(int id) const { return alive_[id]; }
+    int size() const { return count_; }
+
+    /* текущая ячейка сайта id (пустая, если сайт удалён) */
+    const std::vector<Point>& cell(int id) const { return cells_[id]; }
+
+private:
+    static constexpr int kMinCap = 16;
+
+    /*
+     * живые сайты j ≠ id в круге 2R вокруг id, R — радиус ячейки id; список
+     * собирается заранее, потому что f может сам строить ячейки через w_
+     */
+    template <class F>
+    void for_near(int id, F&& f)
+    {
+        const Point& s = p_[id];
+        double lim2 = 4 * radius2(cells_[id], s) + EPS;
+        near_.clear();
+        g_.by_distance(p_, s, id, lim2, w_, [&](int j, double) { near_.push_back(j); });
+        for (int j : near_) f(j);
+    }
+
+    void regrid(int cap)
+    {
+        cap_ = std::max(cap, kMinCap);
+        g_.reset(X_, Y_, cap_);
+        for (int j : live_) g_.add(j, p_[j]);
+    }
+
+    int X_, Y_;
+    int count_ = 0, cap_ = kMinCap;
+    std::vector<Point> rect_;
+    std::vector<Point> p_;
+    std::vector<bool> alive_;
+    std::vector<std::vector<Point>> cells_;
+    std::vector<int> live_, pos_, free_;  /* живые номера, место в live_, свободные */
+    std::vector<int> near_;
+    DynamicGrid g_;
+    Worker w_;
+};
+
+/*
+ * "Чья зона содержит точку": зона сайта — его ячейка Вороного, то есть
+ * владелец точки — ближайший сайт. Поиск ближайшего по KdTree — O(log n) в
+ * среднем. При равных расстояниях выигрывает меньший номер сайта.
+ */
+class SiteLocator {
+public:
+    SiteLocator(int X, int Y, const std::vector<Point>& p)
+        : X_(X), Y_(Y), empty_(p.empty()), tree_(p)
+    {}
+
+    /* номер зоны точки q или -1, если q вне прямоугольника */
+    int locate(const Point& q) const
+    {
+        if (empty_ || q.x < 0 || q.y < 0 || q.x > X_ || q.y > Y_)
+            return -1;
+        return tree_.nearest(q);
+    }
+
+    /* пакет запросов; диапазоны запросов раздаются потокам по мере готовности */
+    std::vector<int> locate(const std::vector<Point>& qs, int threads = 1) const
+    {
+        std::vector<int> res(qs.size());
+        par::for_chunks(static_cast<int>(qs.size()), 4096, threads, [&](int lo, int hi) {
+            for (int i = lo; i < hi; ++i) res[i] = locate(qs[i]);
+        });
+        return res;
+    }
+
+private:
+    int X_, Y_;
+    bool empty_;
+    KdTree tree_;
+};
+
+/* задача: прямоугольник X×Y, n сайтов, на выходе ячейки по порядку */
+inline void run_task(fastio::Reader& in, fastio::Writer& out,
+                     int threads = static_cast<int>(std::thread::hardware_concurrency()))
+{
+    int X, Y, n;
+    std::vector<Point> p;
+    {
+        ALGOS_PHASE("voronoi.parse");
+        X = in.next<int>(), Y = in.next<int>(), n = in.next<int>();
+        p.resize(n);
+        for (auto& pt : p) { in.read(pt.x); in.read(pt.y); }
+    }
+
+    std::vector<std::vector<Point>> zones;
+    {
+        ALGOS_PHASE("voronoi.build");
+        zones = solve(X, Y, p, threads);
+    }
+
+    ALGOS_PHASE("voronoi.output");
+    for (const auto& poly : zones) {
+        out.write(poly.size());
+        for (const auto& v : poly) {
+            out.put(' '); out.write_fixed(v.x, 8);
+            out.put(' '); out.write_fixed(v.y, 8);
+        }
+        out.put('\n');
+    }
+}
+
+}  // namespace voronoi